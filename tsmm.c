@@ -1,8 +1,20 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <math.h>
+#include <time.h>
+#include <errno.h>
 #include <locale.h>
-#include <regex.h>
+#include <limits.h>
+#include <ctype.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <glob.h>
+#include <getopt.h>
+#include <pthread.h>
+#include <signal.h>
 #include "tsmm.h"
 
 
@@ -30,30 +42,29 @@ boolean isTaskDescriptorQueueEmpty(TaskDescriptorQueue* queue) {
 
 
 /* Insere um descritor de tarefa na fila de descritores de tarefa.
-   Adiciona um novo nó contendo o descritor de tarefa fornecido à fila.
-   Se a fila estiver vazia, o novo nó é inserido como o primeiro e último elemento da fila.
-   Caso contrário, o novo nó é adicionado ao final da fila, atualizando o ponteiro 'rear'.
+   Encadeia o descritor fornecido ao final da fila pelo seu campo 'next', sem alocar memória.
+   Se a fila estiver vazia, o descritor é inserido como o primeiro e último elemento da fila.
+   Caso contrário, o descritor é adicionado ao final da fila, atualizando o ponteiro 'rear'.
    Parâmetros:
    - queue: Ponteiro para a fila de descritores de tarefa.
    - taskDescPtr: Ponteiro para o descritor de tarefa a ser inserido na fila.
 */
 void enqueueTaskDescriptor(TaskDescriptorQueue* queue, TaskDescriptor* taskDescPtr) {
-    TaskDescriptorNode* newNode = (TaskDescriptorNode*)malloc(sizeof(TaskDescriptorNode));
-    newNode->taskDescriptorPtr = taskDescPtr;
-    newNode->next = NULL;
+    INSTRUMENTATION_COUNT(COUNTER_ENQUEUES);
+    taskDescPtr->next = NULL;
 
     if (isTaskDescriptorQueueEmpty(queue)) {
-        queue->front = queue->rear = newNode;
+        queue->front = queue->rear = taskDescPtr;
     } 
     else {
-        queue->rear->next = newNode;
-        queue->rear = newNode;
+        queue->rear->next = taskDescPtr;
+        queue->rear = taskDescPtr;
     }
 }//enqueueTaskDescriptor()
 
 /* Remove e retorna o descritor de tarefa no início da fila de descritores de tarefa.
    Se a fila estiver vazia, retorna NULL, indicando que a fila está sem elementos.
-   Caso contrário, remove o primeiro elemento da fila, atualizando o ponteiro 'front'.
+   Caso contrário, desencadeia o primeiro elemento da fila, atualizando o ponteiro 'front', sem liberar memória.
    Parâmetros:
    - queue: Ponteiro para a fila de descritores de tarefa.
    Retorno:
@@ -64,17 +75,37 @@ TaskDescriptor* dequeueTaskDescriptor(TaskDescriptorQueue* queue) {
         return NULL;
     }
 
-    TaskDescriptorNode* temp = queue->front;
-    queue->front = queue->front->next;
-    TaskDescriptor* result = temp->taskDescriptorPtr;
-    free(temp);
+    INSTRUMENTATION_COUNT(COUNTER_DEQUEUES);
+    TaskDescriptor* result = queue->front;
+    queue->front = result->next;
+    result->next = NULL;
 
     return result;
 }//dequeueTaskDescriptor()
 
+/* Move todos os descritores de uma fila para o final de outra, em tempo constante.
+   Parâmetros:
+   - destination: Fila que recebe os descritores.
+   - source: Fila cujos descritores são movidos; fica vazia.
+*/
+void appendTaskDescriptorQueue(TaskDescriptorQueue* destination, TaskDescriptorQueue* source) {
+    if (isTaskDescriptorQueueEmpty(source)) {
+        return;
+    }
+    if (isTaskDescriptorQueueEmpty(destination)) {
+        destination->front = source->front;
+    }
+    else {
+        destination->rear->next = source->front;
+    }
+    destination->rear = source->rear;
+    source->front = source->rear = NULL;
+}//appendTaskDescriptorQueue()
+
 /* Destroi a fila de descritores de tarefa liberando toda a memória alocada.
    Remove cada descritor de tarefa da fila usando a função 'dequeueTaskDescriptor()'
    até que a fila esteja vazia e, em seguida, libera a memória da própria fila.
+   Os descritores não são liberados, pois pertencem à tabela de tarefas.
    Parâmetros:
    - queue: Ponteiro para a fila de descritores de tarefa a ser destruída.
 */
@@ -85,46 +116,578 @@ void destroyTaskDescriptorQueue(TaskDescriptorQueue* queue) {
     free(queue);
 }//destroyTaskDescriptorQueue()
 
-/* Verifica se todas as tarefas foram concluídas.
-   Percorre o vetor de descritores de tarefa verificando o status de cada uma.
+/* Cria um novo heap de descritores de tarefa.
    Parâmetros:
-   - tasks: Array de descritores de tarefa.
-   - numberOfTasks: Número total de tarefas no array.
+   - compare: Função que define a ordem de saída dos descritores.
    Retorno:
-   - TRUE se todas as tarefas estiverem marcadas como 'FINISHED', FALSE caso contrário.
+   - Ponteiro para o heap criado, vazio.
 */
-boolean allTasksFinished(TaskDescriptor tasks[], int numberOfTasks) {
-    for (int i = 0; i < numberOfTasks; i++) {
-        if (tasks[i].status !=  FINISHED) {
+TaskDescriptorHeap* createTaskDescriptorHeap(TaskDescriptorComparator compare) {
+    TaskDescriptorHeap* heap = (TaskDescriptorHeap*)malloc(sizeof(TaskDescriptorHeap));
+    heap->items = (TaskDescriptor**)malloc(INITIAL_HEAP_CAPACITY * sizeof(TaskDescriptor*));
+    heap->size = 0;
+    heap->capacity = INITIAL_HEAP_CAPACITY;
+    heap->compare = compare;
+    return heap;
+}//createTaskDescriptorHeap()
+
+/* Verifica se o heap de descritores de tarefa está vazio.
+   Retorna TRUE se o heap estiver vazio, caso contrário retorna FALSE.
+*/
+boolean isTaskDescriptorHeapEmpty(TaskDescriptorHeap* heap) {
+    return (heap->size == 0);
+}//isTaskDescriptorHeapEmpty()
+
+/* Insere um descritor de tarefa no heap, em O(log n).
+   Parâmetros:
+   - heap: Ponteiro para o heap de descritores de tarefa.
+   - taskDescPtr: Ponteiro para o descritor de tarefa a ser inserido.
+   Retorno:
+   - TRUE se o descritor foi inserido, FALSE se não houve memória para aumentar o heap, que continua como estava.
+*/
+boolean pushTaskDescriptor(TaskDescriptorHeap* heap, TaskDescriptor* taskDescPtr) {
+    INSTRUMENTATION_COUNT(COUNTER_ENQUEUES);
+    if (heap->size == heap->capacity) {
+        TaskDescriptor** items = (TaskDescriptor**)realloc(heap->items, heap->capacity * 2 * sizeof(TaskDescriptor*));
+        if (items == NULL) {
             return FALSE;
         }
-    } 
+        heap->items = items;
+        heap->capacity *= 2;
+    }
+
+    // Sobe o novo elemento até que o pai seja menor ou igual a ele.
+    int child = heap->size++;
+    while (child > 0) {
+        int parent = (child - 1) / 2;
+        if (heap->compare(heap->items[parent], taskDescPtr) <= 0) {
+            break;
+        }
+        heap->items[child] = heap->items[parent];
+        child = parent;
+    }
+    heap->items[child] = taskDescPtr;
+    return TRUE;
+}//pushTaskDescriptor()
+
+/* Retorna o descritor de tarefa do topo do heap, sem removê-lo.
+   Retorno:
+   - Ponteiro para o menor descritor do heap, ou NULL se o heap estiver vazio.
+*/
+TaskDescriptor* peekTaskDescriptor(TaskDescriptorHeap* heap) {
+    if (isTaskDescriptorHeapEmpty(heap)) {
+        return NULL;
+    }
+    return heap->items[0];
+}//peekTaskDescriptor()
+
+/* Remove e retorna o descritor de tarefa do topo do heap, em O(log n).
+   Parâmetros:
+   - heap: Ponteiro para o heap de descritores de tarefa.
+   Retorno:
+   - Ponteiro para o menor descritor do heap, ou NULL se o heap estiver vazio.
+*/
+TaskDescriptor* popTaskDescriptor(TaskDescriptorHeap* heap) {
+    if (isTaskDescriptorHeapEmpty(heap)) {
+        return NULL;
+    }
+
+    INSTRUMENTATION_COUNT(COUNTER_DEQUEUES);
+    TaskDescriptor* result = heap->items[0];
+    TaskDescriptor* last = heap->items[--heap->size];
+
+    // Desce o último elemento a partir da raiz até que os filhos sejam maiores ou iguais a ele.
+    int parent = 0;
+    while (TRUE) {
+        int child = 2 * parent + 1;
+        if (child >= heap->size) {
+            break;
+        }
+        if (child + 1 < heap->size && heap->compare(heap->items[child + 1], heap->items[child]) < 0) {
+            child++;
+        }
+        if (heap->compare(last, heap->items[child]) <= 0) {
+            break;
+        }
+        heap->items[parent] = heap->items[child];
+        parent = child;
+    }
+    if (heap->size > 0) {
+        heap->items[parent] = last;
+    }
+    return result;
+}//popTaskDescriptor()
+
+/* Destroi o heap de descritores de tarefa liberando toda a memória alocada.
+   Os descritores apontados pelo heap não são liberados.
+   Parâmetros:
+   - heap: Ponteiro para o heap a ser destruído.
+*/
+void destroyTaskDescriptorHeap(TaskDescriptorHeap* heap) {
+    free(heap->items);
+    free(heap);
+}//destroyTaskDescriptorHeap()
+
+/* Compara duas tarefas suspensas pelo instante de despertar.
+   Tarefas que despertam no mesmo instante são ordenadas pela ordem de suspensão (FIFO).
+   Retorno:
+   - Valor negativo se 'a' desperta antes de 'b', positivo se depois.
+*/
+int compareWakeUpTime(const TaskDescriptor* a, const TaskDescriptor* b) {
+    if (a->wakeUpTime != b->wakeUpTime) {
+        return a->wakeUpTime < b->wakeUpTime ? -1 : 1;
+    }
+    if (a->wakeUpSequence != b->wakeUpSequence) {
+        return a->wakeUpSequence < b->wakeUpSequence ? -1 : 1;
+    }
+    return 0;
+}//compareWakeUpTime()
+
+/* Inicializa o estado do escalonador.
+   Cria, para cada núcleo, as estruturas de prontos da política e a TLB, cria a fila de despertar das tarefas
+   suspensas e a fila de espera por memória, e zera os relógios.
+   Parâmetros:
+   - scheduler: Ponteiro para o escalonador a ser inicializado.
+   - policy: Política de escalonamento.
+   - numberOfCores: Número de núcleos simulados.
+   - tlb: Configuração da TLB dos núcleos.
+*/
+void initializeScheduler(Scheduler* scheduler, const SchedulingPolicy* policy, unsigned int numberOfCores, const TlbConfiguration* tlb) {
+    memset(scheduler, 0, sizeof(Scheduler));
+    scheduler->policy = policy;
+    scheduler->numberOfCores = numberOfCores;
+    for (unsigned int i = 0; i < numberOfCores; i++) {
+        for (int level = 0; level < NUMBER_OF_FEEDBACK_LEVELS; level++) {
+            scheduler->cores[i].readyQueues[level] = createTaskDescriptorQueue();
+        }
+        if (policy->compare != NULL) {
+            scheduler->cores[i].readyHeap = createTaskDescriptorHeap(policy->compare);
+        }
+        if (tlb->entries > 0) {
+            scheduler->cores[i].tlb.entries = (TlbEntry*)calloc(tlb->entries, sizeof(TlbEntry));
+        }
+    }
+    scheduler->wakeUpQueue = createTaskDescriptorHeap(compareWakeUpTime);
+    scheduler->memoryWaitQueue = createTaskDescriptorQueue();
+    scheduler->nextFeedbackBoost = FEEDBACK_BOOST_PERIOD;
+    scheduler->quantum = DEFAULT_QUANTUM;
+}//initializeScheduler()
+
+/* Libera a memória das filas do escalonador.
+   Parâmetros:
+   - scheduler: Ponteiro para o escalonador.
+*/
+void destroyScheduler(Scheduler* scheduler) {
+    for (unsigned int i = 0; i < scheduler->numberOfCores; i++) {
+        for (int level = 0; level < NUMBER_OF_FEEDBACK_LEVELS; level++) {
+            destroyTaskDescriptorQueue(scheduler->cores[i].readyQueues[level]);
+        }
+        if (scheduler->cores[i].readyHeap != NULL) {
+            destroyTaskDescriptorHeap(scheduler->cores[i].readyHeap);
+        }
+        free(scheduler->cores[i].tlb.entries);
+    }
+    destroyTaskDescriptorHeap(scheduler->wakeUpQueue);
+    destroyTaskDescriptorQueue(scheduler->memoryWaitQueue);
+}//destroyScheduler()
+
+/* Desempata tarefas com a mesma chave pela ordem de entrada na estrutura de prontos (FIFO).
+*/
+int compareReadySequence(const TaskDescriptor* a, const TaskDescriptor* b) {
+    if (a->readySequence != b->readySequence) {
+        return a->readySequence < b->readySequence ? -1 : 1;
+    }
+    return 0;
+}//compareReadySequence()
+
+/* Compara duas tarefas pelo tamanho total do programa (SJF).
+*/
+int compareJobLength(const TaskDescriptor* a, const TaskDescriptor* b) {
+    unsigned int lengthA = a->numberOfInstructions;
+    unsigned int lengthB = b->numberOfInstructions;
+    if (lengthA != lengthB) {
+        return lengthA < lengthB ? -1 : 1;
+    }
+    return compareReadySequence(a, b);
+}//compareJobLength()
+
+/* Compara duas tarefas pela quantidade de instruções restantes (SRTF).
+*/
+int compareRemainingTime(const TaskDescriptor* a, const TaskDescriptor* b) {
+    unsigned int remainingA = a->numberOfInstructions - a->programCounter;
+    unsigned int remainingB = b->numberOfInstructions - b->programCounter;
+    if (remainingA != remainingB) {
+        return remainingA < remainingB ? -1 : 1;
+    }
+    return compareReadySequence(a, b);
+}//compareRemainingTime()
+
+/* Compara duas tarefas pela prioridade estática (menor valor = maior prioridade).
+*/
+int comparePriority(const TaskDescriptor* a, const TaskDescriptor* b) {
+    if (a->priority != b->priority) {
+        return a->priority < b->priority ? -1 : 1;
+    }
+    return compareReadySequence(a, b);
+}//comparePriority()
+
+/* Compara duas tarefas pelo tempo virtual de CPU (fair-share).
+*/
+int compareVirtualRuntime(const TaskDescriptor* a, const TaskDescriptor* b) {
+    if (a->virtualRuntime != b->virtualRuntime) {
+        return a->virtualRuntime < b->virtualRuntime ? -1 : 1;
+    }
+    return compareReadySequence(a, b);
+}//compareVirtualRuntime()
+
+/* Coloca uma tarefa no final da fila FIFO de prontos (Round-Robin e FCFS).
+*/
+boolean enqueueReadyTask(Scheduler* scheduler, Core* core, TaskDescriptor* taskDescriptor) {
+    (void) scheduler;
+    enqueueTaskDescriptor(core->readyQueues[0], taskDescriptor);
+    return TRUE;
+}//enqueueReadyTask()
+
+/* Retira a tarefa do início da fila FIFO de prontos (Round-Robin e FCFS).
+*/
+TaskDescriptor* pickFirstReadyTask(Scheduler* scheduler, Core* core) {
+    (void) scheduler;
+    return dequeueTaskDescriptor(core->readyQueues[0]);
+}//pickFirstReadyTask()
+
+/* Devolve à fila FIFO uma tarefa que esgotou seu quantum.
+*/
+boolean preemptToReadyQueue(Scheduler* scheduler, Core* core, TaskDescriptor* taskDescriptor, TimeUnit ran) {
+    (void) ran;
+    return enqueueReadyTask(scheduler, core, taskDescriptor);
+}//preemptToReadyQueue()
+
+/* Gancho vazio para as políticas que não reagem à suspensão da tarefa.
+*/
+void ignoreBlockedTask(Scheduler* scheduler, TaskDescriptor* taskDescriptor, TimeUnit ran) {
+    (void) scheduler;
+    (void) taskDescriptor;
+    (void) ran;
+}//ignoreBlockedTask()
+
+/* Quantum fixo do Round-Robin e das políticas preemptivas por fatia de tempo.
+*/
+TimeUnit fixedQuantum(Scheduler* scheduler, TaskDescriptor* taskDescriptor) {
+    (void) taskDescriptor;
+    return scheduler->quantum;
+}//fixedQuantum()
+
+/* Quantum das políticas não preemptivas (FCFS e SJF).
+*/
+TimeUnit nonPreemptiveQuantum(Scheduler* scheduler, TaskDescriptor* taskDescriptor) {
+    (void) scheduler;
+    (void) taskDescriptor;
+    return NON_PREEMPTIVE_QUANTUM;
+}//nonPreemptiveQuantum()
+
+/* Quantum do SRTF: uma instrução, para que a tarefa com menos instruções restantes seja reavaliada a cada passo.
+*/
+TimeUnit singleInstructionQuantum(Scheduler* scheduler, TaskDescriptor* taskDescriptor) {
+    (void) scheduler;
+    (void) taskDescriptor;
+    return UT;
+}//singleInstructionQuantum()
+
+/* Coloca uma tarefa no heap de prontos, registrando sua ordem de entrada.
+*/
+boolean pushReadyTask(Scheduler* scheduler, Core* core, TaskDescriptor* taskDescriptor) {
+    taskDescriptor->readySequence = scheduler->readySequence++;
+    return pushTaskDescriptor(core->readyHeap, taskDescriptor);
+}//pushReadyTask()
+
+/* Retira a tarefa do topo do heap de prontos.
+*/
+TaskDescriptor* pickTopReadyTask(Scheduler* scheduler, Core* core) {
+    (void) scheduler;
+    return popTaskDescriptor(core->readyHeap);
+}//pickTopReadyTask()
+
+/* Devolve ao heap de prontos uma tarefa que esgotou seu quantum.
+*/
+boolean preemptToReadyHeap(Scheduler* scheduler, Core* core, TaskDescriptor* taskDescriptor, TimeUnit ran) {
+    (void) ran;
+    return pushReadyTask(scheduler, core, taskDescriptor);
+}//preemptToReadyHeap()
+
+/* Nível efetivo da tarefa na fila multinível: tarefas de uma época anterior ao último reinício voltam ao primeiro nível.
+*/
+unsigned int feedbackLevel(Scheduler* scheduler, TaskDescriptor* taskDescriptor) {
+    if (taskDescriptor->feedbackEpoch != scheduler->feedbackEpoch) {
+        taskDescriptor->feedbackEpoch = scheduler->feedbackEpoch;
+        taskDescriptor->feedbackLevel = 0;
+    }
+    return taskDescriptor->feedbackLevel;
+}//feedbackLevel()
+
+/* Coloca a tarefa na fila do seu nível na fila multinível.
+*/
+boolean enqueueFeedbackTask(Scheduler* scheduler, Core* core, TaskDescriptor* taskDescriptor) {
+    enqueueTaskDescriptor(core->readyQueues[feedbackLevel(scheduler, taskDescriptor)], taskDescriptor);
     return TRUE;
+}//enqueueFeedbackTask()
+
+/* Admite uma tarefa no primeiro nível da fila multinível.
+*/
+boolean arriveFeedbackTask(Scheduler* scheduler, Core* core, TaskDescriptor* taskDescriptor) {
+    taskDescriptor->feedbackEpoch = scheduler->feedbackEpoch;
+    taskDescriptor->feedbackLevel = 0;
+    return enqueueFeedbackTask(scheduler, core, taskDescriptor);
+}//arriveFeedbackTask()
+
+/* Rebaixa um nível a tarefa que esgotou seu quantum na fila multinível.
+*/
+boolean preemptFeedbackTask(Scheduler* scheduler, Core* core, TaskDescriptor* taskDescriptor, TimeUnit ran) {
+    (void) ran;
+    unsigned int level = feedbackLevel(scheduler, taskDescriptor);
+    if (level + 1 < NUMBER_OF_FEEDBACK_LEVELS) {
+        taskDescriptor->feedbackLevel = level + 1;
+    }
+    return enqueueFeedbackTask(scheduler, core, taskDescriptor);
+}//preemptFeedbackTask()
+
+/* Retira a primeira tarefa do nível mais alto não vazio da fila multinível do núcleo.
+   Periodicamente todas as tarefas voltam ao primeiro nível, em tempo constante por núcleo: as filas são concatenadas
+   e a época é incrementada, invalidando o nível guardado em cada tarefa.
+*/
+TaskDescriptor* pickFeedbackTask(Scheduler* scheduler, Core* core) {
+    if (scheduler->clock >= scheduler->nextFeedbackBoost) {
+        for (unsigned int i = 0; i < scheduler->numberOfCores; i++) {
+            for (int level = 1; level < NUMBER_OF_FEEDBACK_LEVELS; level++) {
+                appendTaskDescriptorQueue(scheduler->cores[i].readyQueues[0], scheduler->cores[i].readyQueues[level]);
+            }
+        }
+        scheduler->feedbackEpoch++;
+        scheduler->nextFeedbackBoost = scheduler->clock + FEEDBACK_BOOST_PERIOD;
+    }
+    for (int level = 0; level < NUMBER_OF_FEEDBACK_LEVELS; level++) {
+        if (!isTaskDescriptorQueueEmpty(core->readyQueues[level])) {
+            return dequeueTaskDescriptor(core->readyQueues[level]);
+        }
+    }
+    return NULL;
+}//pickFeedbackTask()
+
+/* Quantum da fila multinível: dobra a cada nível.
+*/
+TimeUnit feedbackQuantum(Scheduler* scheduler, TaskDescriptor* taskDescriptor) {
+    return scheduler->quantum << feedbackLevel(scheduler, taskDescriptor);
+}//feedbackQuantum()
+
+/* Admite uma tarefa na política fair-share com o menor tempo virtual atual.
+*/
+boolean arriveFairShareTask(Scheduler* scheduler, Core* core, TaskDescriptor* taskDescriptor) {
+    taskDescriptor->virtualRuntime = scheduler->minVirtualRuntime;
+    return pushReadyTask(scheduler, core, taskDescriptor);
+}//arriveFairShareTask()
+
+/* Retira a tarefa com menor tempo virtual e avança o tempo virtual mínimo.
+*/
+TaskDescriptor* pickFairShareTask(Scheduler* scheduler, Core* core) {
+    TaskDescriptor* taskDescriptor = popTaskDescriptor(core->readyHeap);
+    if (taskDescriptor != NULL && taskDescriptor->virtualRuntime > scheduler->minVirtualRuntime) {
+        scheduler->minVirtualRuntime = taskDescriptor->virtualRuntime;
+    }
+    return taskDescriptor;
+}//pickFairShareTask()
+
+/* Contabiliza o tempo de CPU da tarefa no tempo virtual, ponderado pela prioridade.
+*/
+void chargeFairShareTask(Scheduler* scheduler, TaskDescriptor* taskDescriptor, TimeUnit ran) {
+    (void) scheduler;
+    int weight = taskDescriptor->priority < 0 ? 1 : taskDescriptor->priority + 1;
+    taskDescriptor->virtualRuntime += (unsigned long long) ran * weight;
+}//chargeFairShareTask()
+
+/* Devolve ao heap uma tarefa fair-share que esgotou seu quantum.
+*/
+boolean preemptFairShareTask(Scheduler* scheduler, Core* core, TaskDescriptor* taskDescriptor, TimeUnit ran) {
+    chargeFairShareTask(scheduler, taskDescriptor, ran);
+    return pushReadyTask(scheduler, core, taskDescriptor);
+}//preemptFairShareTask()
+
+/* Devolve ao heap uma tarefa fair-share que despertou, sem permitir que ela acumule crédito enquanto suspensa.
+*/
+boolean wakeFairShareTask(Scheduler* scheduler, Core* core, TaskDescriptor* taskDescriptor) {
+    if (taskDescriptor->virtualRuntime < scheduler->minVirtualRuntime) {
+        taskDescriptor->virtualRuntime = scheduler->minVirtualRuntime;
+    }
+    return pushReadyTask(scheduler, core, taskDescriptor);
+}//wakeFairShareTask()
+
+// Políticas de escalonamento disponíveis.
+const SchedulingPolicy SCHEDULING_POLICIES[NUMBER_OF_SCHEDULING_POLICIES] = {
+    {"rr", "Round-Robin", NULL, pickFirstReadyTask, enqueueReadyTask, preemptToReadyQueue, ignoreBlockedTask, enqueueReadyTask, fixedQuantum},
+    {"fcfs", "FCFS", NULL, pickFirstReadyTask, enqueueReadyTask, preemptToReadyQueue, ignoreBlockedTask, enqueueReadyTask, nonPreemptiveQuantum},
+    {"sjf", "SJF", compareJobLength, pickTopReadyTask, pushReadyTask, preemptToReadyHeap, ignoreBlockedTask, pushReadyTask, nonPreemptiveQuantum},
+    {"srtf", "SRTF", compareRemainingTime, pickTopReadyTask, pushReadyTask, preemptToReadyHeap, ignoreBlockedTask, pushReadyTask, singleInstructionQuantum},
+    {"priority", "Prioridade estática", comparePriority, pickTopReadyTask, pushReadyTask, preemptToReadyHeap, ignoreBlockedTask, pushReadyTask, fixedQuantum},
+    {"mlfq", "Fila multinível com realimentação", NULL, pickFeedbackTask, arriveFeedbackTask, preemptFeedbackTask, ignoreBlockedTask, enqueueFeedbackTask, feedbackQuantum},
+    {"fair", "Fair-share (tempo virtual)", compareVirtualRuntime, pickFairShareTask, arriveFairShareTask, preemptFairShareTask, chargeFairShareTask, wakeFairShareTask, fixedQuantum}
+};
+
+/* Procura uma política de escalonamento pelo nome usado na linha de comando.
+   Parâmetros:
+   - name: Nome da política.
+   - length: Quantidade de bytes do nome.
+   Retorno:
+   - Ponteiro para a política, ou NULL se o nome for desconhecido.
+*/
+const SchedulingPolicy* findSchedulingPolicy(const char *name, size_t length) {
+    for (int i = 0; i < NUMBER_OF_SCHEDULING_POLICIES; i++) {
+        if (strlen(SCHEDULING_POLICIES[i].name) == length && strncmp(SCHEDULING_POLICIES[i].name, name, length) == 0) {
+            return &SCHEDULING_POLICIES[i];
+        }
+    }
+    return NULL;
+}//findSchedulingPolicy()
+
+/* Escolhe o próximo núcleo a escalonar: o de menor relógio local.
+   Avançar sempre o núcleo mais atrasado mantém os núcleos sincronizados e o relógio global monotônico.
+   Parâmetros:
+   - scheduler: Ponteiro para o escalonador.
+   Retorno:
+   - Ponteiro para o núcleo escolhido.
+*/
+Core* nextCore(Scheduler* scheduler) {
+    Core* core = &scheduler->cores[0];
+    for (unsigned int i = 1; i < scheduler->numberOfCores; i++) {
+        if (scheduler->cores[i].clock < core->clock) {
+            core = &scheduler->cores[i];
+        }
+    }
+    return core;
+}//nextCore()
+
+/* Retira a próxima tarefa pronta de um núcleo segundo a política de escalonamento.
+   Parâmetros:
+   - scheduler: Ponteiro para o escalonador.
+   - core: Núcleo cuja estrutura de prontos será consultada.
+   Retorno:
+   - Ponteiro para a tarefa, ou NULL se o núcleo não tiver tarefas prontas.
+*/
+TaskDescriptor* pickReadyTask(Scheduler* scheduler, Core* core) {
+    if (core->numberOfReadyTasks == 0) {
+        return NULL;
+    }
+    TaskDescriptor* taskDescriptor = scheduler->policy->pickNext(scheduler, core);
+    if (taskDescriptor != NULL) {
+        core->numberOfReadyTasks--;
+    }
+    return taskDescriptor;
+}//pickReadyTask()
+
+/* Rouba uma tarefa pronta do núcleo com mais tarefas prontas para um núcleo ocioso.
+   A tarefa roubada é a que a política escolheria em seguida no núcleo de origem, e a migração é contabilizada.
+   Só são vítimas os núcleos cujo relógio não passou do relógio do núcleo ocioso; sem vítima, o chamador avança o
+   relógio ocioso até o próximo evento. Se ainda assim a tarefa ficou pronta depois desse relógio, o chamador o avança
+   até o instante 'readyTime' antes de executá-la.
+   Parâmetros:
+   - scheduler: Ponteiro para o escalonador.
+   - thief: Núcleo ocioso que recebe a tarefa.
+   - roundRobin: Estrutura RoundRobin que acumula as migrações.
+   Retorno:
+   - Ponteiro para a tarefa roubada, ou NULL se nenhum outro núcleo tiver tarefas prontas.
+*/
+TaskDescriptor* stealTask(Scheduler* scheduler, Core* thief, RoundRobin* roundRobin) {
+    Core* victim = NULL;
+    for (unsigned int i = 0; i < scheduler->numberOfCores; i++) {
+        Core* core = &scheduler->cores[i];
+        // Um núcleo adiantado pode ter tarefas que ainda não estavam prontas no relógio do núcleo ocioso.
+        if (core != thief && core->numberOfReadyTasks > 0 && core->clock <= thief->clock && (victim == NULL || core->numberOfReadyTasks > victim->numberOfReadyTasks)) {
+            victim = core;
+        }
+    }
+    if (victim == NULL) {
+        return NULL;
+    }
+
+    TaskDescriptor* taskDescriptor = pickReadyTask(scheduler, victim);
+    if (taskDescriptor != NULL) {
+        roundRobin->migrations++;
+        roundRobin->cores[thief - scheduler->cores].migrations++;
+    }
+    return taskDescriptor;
+}//stealTask()
+
+/* Verifica se todas as tarefas foram concluídas.
+   Compara a contagem de tarefas no estado 'FINISHED', mantida pelo RoundRobin, com o número total de tarefas,
+   em tempo constante.
+   Parâmetros:
+   - roundRobin: Estrutura RoundRobin com a contagem de tarefas por estado.
+   - numberOfTasks: Número total de tarefas.
+   Retorno:
+   - TRUE se todas as tarefas estiverem marcadas como 'FINISHED', FALSE caso contrário.
+*/
+boolean allTasksFinished(RoundRobin* roundRobin, int numberOfTasks) {
+    return (roundRobin->tasksPerStatus[FINISHED] == (unsigned int) numberOfTasks);
 }//allTasksFinished()
 
+/* Altera o estado de uma tarefa, mantendo a contagem de tarefas por estado.
+   Todas as transições de estado durante o escalonamento devem passar por esta função, que também as inclui
+   no registro de execução, se houver.
+   Parâmetros:
+   - taskDescriptor: Ponteiro para o descritor de tarefa.
+   - status: Novo estado da tarefa.
+   - roundRobin: Estrutura RoundRobin com a contagem de tarefas por estado e o registro de execução.
+*/
+void changeTaskStatus(TaskDescriptor* taskDescriptor, TaskStatus status, RoundRobin* roundRobin) {
+    if (roundRobin->trace != NULL) {
+        TimeUnit now = roundRobin->coreClock + roundRobin->preemptionTimeCounter - UT;
+        // A leitura de disco e a falta de página suspendem a tarefa ao final da instrução, já contada como tempo de CPU;
+        // a espera por quadros livres repete a instrução, que não consome tempo.
+        if (taskDescriptor->status == RUNNING && status == SUSPENDED && taskDescriptor->framesWanted == 0) {
+            now += UT;
+        }
+        // Uma tarefa suspensa desperta no seu próprio instante, não no relógio do núcleo que a despertou.
+        if (taskDescriptor->status == SUSPENDED && status == READY) {
+            now = taskDescriptor->readyTime;
+        }
+        recordTaskStatus(roundRobin->trace, taskDescriptor, status, now);
+    }
+    roundRobin->tasksPerStatus[taskDescriptor->status]--;
+    roundRobin->tasksPerStatus[status]++;
+    taskDescriptor->status = status;
+}//changeTaskStatus()
+
 /* Simula a leitura do disco por uma tarefa.
-   Atualiza o status da tarefa para 'SUSPENDED' e adiciona o tempo de E/S ao tempo total de entrada/saída da tarefa.
+   Atualiza o status da tarefa para 'SUSPENDED', adiciona o tempo de E/S ao tempo de entrada/saída da tarefa e ao total
+   do sistema e insere a tarefa na fila de despertar com o instante absoluto em que ela volta a ficar pronta.
    Parâmetros:
    - taskDescriptor: Ponteiro para o descritor de tarefa a ser modificado.
+   - scheduler: Ponteiro para o escalonador.
+   - roundRobin: Estrutura RoundRobin com a contagem de tarefas por estado.
 */
-void readDisk(TaskDescriptor* taskDescriptor) {
-    taskDescriptor->status = SUSPENDED;
-    taskDescriptor->suspendedTime += SUSPENDED_TIME;
+void readDisk(TaskDescriptor* taskDescriptor, Scheduler* scheduler, RoundRobin* roundRobin) {
+    INSTRUMENTATION_COUNT(COUNTER_IO_SUSPENSIONS);
+    changeTaskStatus(taskDescriptor, SUSPENDED, roundRobin);
+    // A leitura começa ao final da instrução, no relógio do núcleo em que a tarefa executa.
+    taskDescriptor->wakeUpTime = roundRobin->coreClock + roundRobin->preemptionTimeCounter + SUSPENDED_TIME;
+    taskDescriptor->wakeUpSequence = scheduler->suspensions++;
     taskDescriptor->inputOutputTime += SUSPENDED_TIME;
+    roundRobin->totalOutputTime += SUSPENDED_TIME;
+    if (!pushTaskDescriptor(scheduler->wakeUpQueue, taskDescriptor)) {
+        abortUnscheduledTask(taskDescriptor, roundRobin);
+    }
 }//readDisk()
 
 /* Imprime os descritores das tarefas ativas.
    Itera sobre as tarefas verificando se foram abortadas. Se não foram abortadas,
    imprime o descritor da tarefa usando a função 'printTaskDescriptor'.
    Parâmetros:
+   - output: Saída do relatório.
    - tasks: Array de descritores de tarefa.
    - numberOfTasks: Número total de tarefas no array.
    - roundRobin: Estrutura RoundRobin contendo informações do sistema.
 */
-void printTasks(TaskDescriptor tasks[], int numberOfTasks, RoundRobin roundRobin) {
+void printTasks(FILE *output, const TaskDescriptor tasks[], int numberOfTasks, const RoundRobin* roundRobin) {
     for (int i = 0; i < numberOfTasks; i++) {
         if (tasks[i].aborted == FALSE) {
-            printTaskDescriptor(tasks[i], roundRobin);
+            printTaskDescriptor(output, &tasks[i], roundRobin);
         }
     }
 }//printTasks()
@@ -136,8 +699,8 @@ void printTasks(TaskDescriptor tasks[], int numberOfTasks, RoundRobin roundRobin
    Retorno:
    - Taxa de ocupação da CPU (float).
 */
-float calculateCPURate(TaskDescriptor taskDesc, RoundRobin roundRobin) {
-    return ((float)taskDesc.cpuTime / roundRobin.totalCPUClocks) * 100;
+float calculateCPURate(const TaskDescriptor* taskDesc, const RoundRobin* roundRobin) {
+    return ((float)taskDesc->cpuTime / roundRobin->totalCPUClocks) * 100;
 }//calculateCPURate()
 
 /* Calcula a taxa de ocupação do disco de uma tarefa.
@@ -147,10 +710,80 @@ float calculateCPURate(TaskDescriptor taskDesc, RoundRobin roundRobin) {
    Retorno:
    - Taxa de ocupação de disco (float).
 */
-float calculateDiskRate(TaskDescriptor taskDesc, RoundRobin roundRobin) {
-    return ((float)taskDesc.inputOutputTime / roundRobin.totalOutputTime) * 100;
+float calculateDiskRate(const TaskDescriptor* taskDesc, const RoundRobin* roundRobin) {
+    return ((float)taskDesc->inputOutputTime / roundRobin->totalOutputTime) * 100;
 }//calculateDiskRate()
 
+/* Calcula a taxa de ociosidade da CPU.
+   Parâmetros:
+   - roundRobin: Estrutura RoundRobin contendo informações do sistema.
+   Retorno:
+   - Percentual do tempo decorrido, somado em todos os núcleos, em que a CPU ficou ociosa (float).
+*/
+float calculateIdleRate(const RoundRobin* roundRobin) {
+    if (roundRobin->elapsedTime == 0) {
+        return 0.0f;
+    }
+    return ((float)roundRobin->idleTime / ((unsigned long long) roundRobin->elapsedTime * roundRobin->numberOfCores)) * 100;
+}//calculateIdleRate()
+
+/* Calcula a taxa de ocupação de um núcleo de CPU.
+   Parâmetros:
+   - roundRobin: Estrutura RoundRobin contendo informações do sistema.
+   - core: Índice do núcleo.
+   Retorno:
+   - Percentual do tempo decorrido em que o núcleo executou instruções (float).
+*/
+float calculateCoreCPURate(const RoundRobin* roundRobin, unsigned int core) {
+    if (roundRobin->elapsedTime == 0) {
+        return 0.0f;
+    }
+    return ((float)roundRobin->cores[core].busyTime / roundRobin->elapsedTime) * 100;
+}//calculateCoreCPURate()
+
+/* Calcula a taxa de faltas de página.
+   Parâmetros:
+   - pageFaults: Faltas de página.
+   - memoryAccesses: Acessos à memória.
+   Retorno:
+   - Porcentagem de acessos que causaram falta de página.
+*/
+float calculatePageFaultRate(unsigned long long pageFaults, unsigned long long memoryAccesses) {
+    if (memoryAccesses == 0) {
+        return 0.0f;
+    }
+    return (float) pageFaults / memoryAccesses * 100;
+}//calculatePageFaultRate()
+
+/* Calcula a taxa de acertos da TLB.
+   Parâmetros:
+   - hits: Acertos na TLB.
+   - misses: Faltas na TLB.
+   Retorno:
+   - Porcentagem de consultas à TLB que foram acertos, ou 0 se a TLB não foi consultada.
+*/
+float calculateTlbHitRate(unsigned long long hits, unsigned long long misses) {
+    if (hits + misses == 0) {
+        return 0.0f;
+    }
+    return ((float) hits / (hits + misses)) * 100;
+}//calculateTlbHitRate()
+
+/* Calcula o tempo efetivo de acesso à memória com a TLB.
+   Um acerto custa a consulta à TLB e o acesso à memória; uma falta custa também a consulta à tabela de páginas.
+   Parâmetros:
+   - hits: Acertos na TLB.
+   - misses: Faltas na TLB.
+   Retorno:
+   - Tempo médio de acesso, em nanossegundos.
+*/
+float calculateEffectiveAccessTime(unsigned long long hits, unsigned long long misses) {
+    if (hits + misses == 0) {
+        return 0.0f;
+    }
+    return (float) (hits * (TLB_LOOKUP_TIME + MEMORY_ACCESS_TIME) + misses * (TLB_LOOKUP_TIME + 2 * MEMORY_ACCESS_TIME)) / (hits + misses);
+}//calculateEffectiveAccessTime()
+
 /* Conta o número de tarefas executadas com sucesso.
    Itera sobre as tarefas verificando se foram abortadas. Se uma tarefa não foi abortada,
    incrementa o contador de tarefas executadas com sucesso.
@@ -160,7 +793,7 @@ float calculateDiskRate(TaskDescriptor taskDesc, RoundRobin roundRobin) {
    Retorno:
    - Número de tarefas executadas com sucesso.
 */
-int numberOfTasksPerformedSuccessfully(TaskDescriptor tasks[], int numberOfTasks) {
+int numberOfTasksPerformedSuccessfully(const TaskDescriptor tasks[], int numberOfTasks) {
     int successfully = 0;
     for (int i = 0; i < numberOfTasks; i++) {
         if (tasks[i].aborted == FALSE) {
@@ -171,598 +804,5226 @@ int numberOfTasksPerformedSuccessfully(TaskDescriptor tasks[], int numberOfTasks
 }//numberOfTasksPerformedSuccessfully()
 
 /* Imprime informações do Round-Robin.
-   Esta função imprime métricas do algoritmo Round-Robin, como o tempo médio de execução e o tempo médio de espera.
+   Esta função imprime métricas da política de escalonamento, como o tempo médio de execução, o tempo médio de espera
+   e a vazão (tarefas concluídas por unidade de tempo de CPU), o tempo ocioso da CPU,
+   além da contagem de tarefas por estado, de tarefas abortadas, do pico de quadros físicos em uso e das esperas
+   por memória; a geometria de memória e o quantum, quando diferentes dos padrões; com limite de programas residentes,
+   o pico de programas residentes e as recargas. Na paginação sob demanda,
+   imprime a política de substituição, a taxa de faltas de página e as substituições; com TLB, a configuração,
+   os acertos, as faltas, os esvaziamentos e o tempo efetivo de acesso. Com mais de um núcleo, imprime também
+   as migrações e a ocupação, o tempo ocioso e os despachos de cada núcleo.
    Utiliza o número de tarefas executadas com sucesso para calcular esses valores.
    Parâmetros:
+   - output: Saída do relatório.
    - roundRobin: Estrutura RoundRobin contendo informações do sistema.
    - numberOfTasksPerformedSuccessfully: Número de tarefas executadas com sucesso.
 */
-void printRoundRobin(RoundRobin roundRobin, int numberOfTasksPerformedSuccessfully) {
-    printf("\n\n- Round-Robin\n");
-    printf("\t\tTempo médio de execução = %.2f s\n", (float) roundRobin.totalCPUClocks / numberOfTasksPerformedSuccessfully);
-    printf("\t\tTempo médio de espera = %.2f s\n", (float) roundRobin.waitTime / numberOfTasksPerformedSuccessfully);
+void printRoundRobin(FILE *output, const RoundRobin* roundRobin, int numberOfTasksPerformedSuccessfully) {
+    fprintf(output, "\n\n- %s\n", roundRobin->policyName != NULL ? roundRobin->policyName : "Round-Robin");
+    fprintf(output, "\t\tTempo médio de execução = %.2f s\n", (float) roundRobin->totalCPUClocks / numberOfTasksPerformedSuccessfully);
+    fprintf(output, "\t\tTempo médio de espera = %.2f s\n", (float) roundRobin->waitTime / numberOfTasksPerformedSuccessfully);
+    fprintf(output, "\t\tVazão = %.4f tarefas/ut\n", roundRobin->totalCPUClocks > 0 ? (float) numberOfTasksPerformedSuccessfully / roundRobin->totalCPUClocks : 0.0f);
+    fprintf(output, "\t\tTempo ocioso da CPU = %u ut (%.2f%%)\n", roundRobin->idleTime, calculateIdleRate(roundRobin));
+    fprintf(output, "\t\tTarefas por estado = prontas: %u, executando: %u, suspensas: %u, finalizadas: %u\n",
+        roundRobin->tasksPerStatus[READY], roundRobin->tasksPerStatus[RUNNING], roundRobin->tasksPerStatus[SUSPENDED], roundRobin->tasksPerStatus[FINISHED]);
+    fprintf(output, "\t\tTarefas abortadas = %u\n", roundRobin->abortedTasks);
+    const MachineConfiguration* machine = &roundRobin->machine;
+    if (machine->pageSize != DEFAULT_PAGE_SIZE || machine->physicalMemorySize != DEFAULT_PHYSICAL_MEMORY_SIZE
+        || machine->logicalMemorySize != DEFAULT_LOGICAL_MEMORY_SIZE || machine->quantum != DEFAULT_QUANTUM) {
+        fprintf(output, "\t\tMemória = páginas de %u bytes, %u quadros (%u reservados), memória lógica de %u bytes, quantum = %u ut\n",
+            machine->pageSize, machine->numberOfFrames, machine->reservedFrames, machine->logicalMemorySize, machine->quantum);
+    }
+    fprintf(output, "\t\tQuadros físicos em uso (pico) = %u de %u\n", roundRobin->frameAllocator.peakFramesInUse, machine->numberOfFrames - machine->reservedFrames);
+    fprintf(output, "\t\tEsperas por memória física = %u\n", roundRobin->memoryWaits);
+    if (roundRobin->residentProgramLimit > 0) {
+        fprintf(output, "\t\tProgramas residentes = pico de %u, limite de %u, recargas = %llu\n",
+            roundRobin->peakResidentPrograms, roundRobin->residentProgramLimit, roundRobin->programReloads);
+    }
+    if (roundRobin->frameAllocator.replacement != NULL) {
+        fprintf(output, "\t\tSubstituição de páginas = %s\n", roundRobin->frameAllocator.replacement->displayName);
+        fprintf(output, "\t\tFaltas de página = %llu em %llu acessos (%.2f%%)\n", roundRobin->pageFaults, roundRobin->memoryAccesses,
+            calculatePageFaultRate(roundRobin->pageFaults, roundRobin->memoryAccesses));
+        fprintf(output, "\t\tSubstituições de página = %llu\n", roundRobin->pageReplacements);
+    }
+    if (roundRobin->tlb.entries > 0) {
+        fprintf(output, "\t\tTLB = %u entradas, %u vias, %s, %s\n", roundRobin->tlb.entries, roundRobin->tlb.ways,
+            roundRobin->tlb.replacement == TLB_LRU ? "LRU" : "FIFO", roundRobin->tlb.asid ? "ASID" : "esvaziada na troca de contexto");
+        fprintf(output, "\t\tTLB: acertos = %llu, faltas = %llu (%.2f%% de acertos), esvaziamentos = %llu, tempo efetivo de acesso = %.2f ns\n",
+            roundRobin->tlbHits, roundRobin->tlbMisses, calculateTlbHitRate(roundRobin->tlbHits, roundRobin->tlbMisses),
+            roundRobin->tlbFlushes, calculateEffectiveAccessTime(roundRobin->tlbHits, roundRobin->tlbMisses));
+    }
+    if (roundRobin->numberOfCores > 1) {
+        fprintf(output, "\t\tNúcleos = %u\n", roundRobin->numberOfCores);
+        fprintf(output, "\t\tMigrações = %u\n", roundRobin->migrations);
+        for (unsigned int i = 0; i < roundRobin->numberOfCores; i++) {
+            fprintf(output, "\t\t- Núcleo %u: ocupação = %.2f%%, ocioso = %u ut, despachos = %u, migrações recebidas = %u\n",
+                i, calculateCoreCPURate(roundRobin, i), roundRobin->cores[i].idleTime, roundRobin->cores[i].dispatches, roundRobin->cores[i].migrations);
+        }
+    }
 }//printRoundRobin()
 
 /* Imprime as informações de memória de uma variável da tarefa.
+   Os endereços físicos são traduzidos pela tabela de páginas ao final da execução.
    Parâmetros:
+   - output: Saída do relatório.
+   - taskDesc: Descritor de tarefa (TaskDescriptor) dona da variável.
    - var: Variável (Variable) da tarefa.
+   - machine: Geometria de memória, que define a página e o deslocamento dos endereços.
 */
-void printVariableMemoryInfo(Variable var) {
-    printf("\t\tEndereço Lógicos = %u a %u ( %u : %u a %u : %u )\n", var.logicalMemory.logicalInitialByte, var.logicalMemory.logicalFinalByte,
-        var.logicalMemory.logicalInitialByte / LOGICAL_PHYSICAL_PAGE_SIZE, var.logicalMemory.logicalInitialByte % LOGICAL_PHYSICAL_PAGE_SIZE,
-        var.logicalMemory.logicalFinalByte / LOGICAL_PHYSICAL_PAGE_SIZE, var.logicalMemory.logicalFinalByte % LOGICAL_PHYSICAL_PAGE_SIZE);
-    printf("\t\tEndereço Físicos = %u a %u ( %u : %u a %u : %u )\n", var.physicalMemory.physicalInitialByte, var.physicalMemory.physicalFinalByte,
-        var.physicalMemory.physicalInitialByte / LOGICAL_PHYSICAL_PAGE_SIZE, var.physicalMemory.physicalInitialByte % LOGICAL_PHYSICAL_PAGE_SIZE, 
-        var.physicalMemory.physicalFinalByte / LOGICAL_PHYSICAL_PAGE_SIZE, var.physicalMemory.physicalFinalByte % LOGICAL_PHYSICAL_PAGE_SIZE);
+void printVariableMemoryInfo(FILE *output, const TaskDescriptor* taskDesc, const Variable* var, const MachineConfiguration* machine) {
+    fprintf(output, "\t\tEndereço Lógicos = %u a %u ( %u : %u a %u : %u )\n", var->logicalMemory.logicalInitialByte, var->logicalMemory.logicalFinalByte,
+        addressPage(machine, var->logicalMemory.logicalInitialByte), addressOffset(machine, var->logicalMemory.logicalInitialByte),
+        addressPage(machine, var->logicalMemory.logicalFinalByte), addressOffset(machine, var->logicalMemory.logicalFinalByte));
+    if (taskDesc->memory->pagination.frames[addressPage(machine, var->logicalMemory.logicalInitialByte)] == NO_FRAME
+        || taskDesc->memory->pagination.frames[addressPage(machine, var->logicalMemory.logicalFinalByte)] == NO_FRAME) {
+        fprintf(output, "\t\tEndereço Físicos = página não residente\n");
+        return;
+    }
+    unsigned int physicalInitialByte = translateAddress(taskDesc, machine, var->logicalMemory.logicalInitialByte);
+    unsigned int physicalFinalByte = translateAddress(taskDesc, machine, var->logicalMemory.logicalFinalByte);
+    fprintf(output, "\t\tEndereço Físicos = %u a %u ( %u : %u a %u : %u )\n", physicalInitialByte, physicalFinalByte,
+        addressPage(machine, physicalInitialByte), addressOffset(machine, physicalInitialByte), 
+        addressPage(machine, physicalFinalByte), addressOffset(machine, physicalFinalByte));
 }//printVariableMemoryInfo()
 
-/* Calcula e imprime as informações da tabela de páginas de uma tarefa.
+/* Imprime a tabela de páginas de uma tarefa, com o quadro físico de cada página mapeada.
+   Na paginação sob demanda, mostra os quadros das páginas residentes ao final da execução.
    Parâmetros:
+   - output: Saída do relatório.
    - taskDesc: Descritor de tarefa (TaskDescriptor).
+   - machine: Geometria de memória.
 */
-void printPageTableInfo(TaskDescriptor taskDesc) {
-    for (int i = 0; i < taskDesc.pagination.finalPage; ++i) {
-        printf("\t\tPL %d (%u a %u) --> PF %d (%u a %u)\n", i, i * LOGICAL_PHYSICAL_PAGE_SIZE, (i + 1) * LOGICAL_PHYSICAL_PAGE_SIZE - 1, 
-        taskDesc.pagination.initialBytesAllocated / LOGICAL_PHYSICAL_PAGE_SIZE + i,
-        ((taskDesc.pagination.initialBytesAllocated / LOGICAL_PHYSICAL_PAGE_SIZE) + i) * LOGICAL_PHYSICAL_PAGE_SIZE, 
-        ((taskDesc.pagination.initialBytesAllocated / LOGICAL_PHYSICAL_PAGE_SIZE) + i) * LOGICAL_PHYSICAL_PAGE_SIZE + LOGICAL_PHYSICAL_PAGE_SIZE - 1);
+void printPageTableInfo(FILE *output, const TaskDescriptor* taskDesc, const MachineConfiguration* machine) {
+    for (unsigned int i = 0; i < taskDesc->memory->pagination.mappedPages; ++i) {
+        unsigned int frame = taskDesc->memory->pagination.frames[i];
+        if (frame == NO_FRAME) {
+            fprintf(output, "\t\tPL %u (%u a %u) --> não residente\n", i, pageAddress(machine, i), pageAddress(machine, i + 1) - 1);
+            continue;
+        }
+        fprintf(output, "\t\tPL %u (%u a %u) --> PF %u (%u a %u)\n", i, pageAddress(machine, i), pageAddress(machine, i + 1) - 1, 
+        frame, pageAddress(machine, frame), pageAddress(machine, frame + 1) - 1);
     }
 }//printPageTableInfo()
 
-/* Imprime todas as informações de uma tarefa.
+/* Imprime todas as informações de uma tarefa, incluindo a taxa de faltas de página na paginação sob demanda
+   e os acertos na TLB com o tempo efetivo de acesso.
    Parâmetros:
+   - output: Saída do relatório.
    - taskDesc: Descritor de tarefa (TaskDescriptor).
    - roundRobin: Estrutura RoundRobin contendo informações do sistema.
 */
-void printTaskDescriptor(TaskDescriptor taskDesc, RoundRobin roundRobin) {
-    printf("\n\n- Tarefa: %s\n", taskDesc.task.nameOfTask);
-    printf("\t- CPU e Disco\n");
-    printf("\t\tTempo de CPU = %hu ut\n", taskDesc.cpuTime);
-    printf("\t\tTempo de E/S = %hu ut\n", taskDesc.inputOutputTime);
-    printf("\t\tTaxa de ocupação da CPU = %.2f%%\n", calculateCPURate(taskDesc, roundRobin));
-    printf("\t\tTaxa de ocupação do disco = %.2f%%\n", calculateDiskRate(taskDesc, roundRobin));
-    printf("\t- Memória\n");
-    printf("\t\tNúmero de páginas lógicas = %u\n", taskDesc.pagination.finalPage );
+void printTaskDescriptor(FILE *output, const TaskDescriptor* taskDesc, const RoundRobin* roundRobin) {
+    fprintf(output, "\n\n- Tarefa: %s\n", taskDesc->task->nameOfTask);
+    fprintf(output, "\t- CPU e Disco\n");
+    fprintf(output, "\t\tTempo de CPU = %u ut\n", taskDesc->cpuTime);
+    fprintf(output, "\t\tTempo de E/S = %u ut\n", taskDesc->inputOutputTime);
+    fprintf(output, "\t\tTaxa de ocupação da CPU = %.2f%%\n", calculateCPURate(taskDesc, roundRobin));
+    fprintf(output, "\t\tTaxa de ocupação do disco = %.2f%%\n", calculateDiskRate(taskDesc, roundRobin));
+    fprintf(output, "\t- Memória\n");
+    fprintf(output, "\t\tNúmero de páginas lógicas = %u\n", taskDesc->memory->pagination.mappedPages);
+    if (roundRobin->frameAllocator.replacement != NULL) {
+        fprintf(output, "\t\tFaltas de página = %u em %llu acessos (%.2f%%)\n", taskDesc->memory->pageFaults, taskDesc->memory->accessLog.numberOfAccesses,
+            calculatePageFaultRate(taskDesc->memory->pageFaults, taskDesc->memory->accessLog.numberOfAccesses));
+    }
+    if (roundRobin->tlb.entries > 0) {
+        fprintf(output, "\t\tTLB: acertos = %llu, faltas = %llu (%.2f%% de acertos), tempo efetivo de acesso = %.2f ns\n",
+            taskDesc->memory->tlbHits, taskDesc->memory->tlbMisses, calculateTlbHitRate(taskDesc->memory->tlbHits, taskDesc->memory->tlbMisses),
+            calculateEffectiveAccessTime(taskDesc->memory->tlbHits, taskDesc->memory->tlbMisses));
+    }
 
-    for (int i = 0; i < taskDesc.quantityVariables; ++i) {
-        Variable var = taskDesc.variable[i];
-        printf("\n\t\t- %s\n", var.name);
-        printVariableMemoryInfo(var);
+    for (unsigned int i = 0; i < taskDesc->memory->quantityVariables; ++i) {
+        const Variable* var = &taskDesc->memory->variables[i];
+        fprintf(output, "\n\t\t- %s\n", var->name);
+        printVariableMemoryInfo(output, taskDesc, var, &roundRobin->machine);
     }
 
-    printTaskMemoryAccesses(taskDesc);
+    printTaskMemoryAccesses(output, taskDesc, &roundRobin->machine);
 
-    printf("\n\t\t- Tabela de Páginas\n");
-    printPageTableInfo(taskDesc);
+    fprintf(output, "\n\t\t- Tabela de Páginas\n");
+    printPageTableInfo(output, taskDesc, &roundRobin->machine);
 }//printTaskDescriptor()
 
-/* Atualiza a memória lógica de uma variável de uma tarefa.
-   Esta função atualiza os endereços lógicos de uma variável da tarefa com base no valor alocado.
-   Calcula os endereços lógicos inicial e final, bem como atualiza a página final de paginação da tarefa.
+/* Imprime o relatório de uma simulação no formato texto: as métricas da política e as tarefas executadas.
    Parâmetros:
-   - taskDescriptor: Ponteiro para o descritor de tarefa (TaskDescriptor).
-   - index: Índice da variável no array de variáveis da tarefa.
-   - value: Valor alocado para a variável.
+   - output: Saída do relatório.
+   - roundRobin: Estrutura RoundRobin contendo informações do sistema.
+   - tasks: Array de descritores de tarefa.
+   - numberOfTasks: Número total de tarefas no array.
 */
-void updateLogicalMemory(TaskDescriptor* taskDescriptor, int index, int value) {
-    taskDescriptor->variable[index].logicalMemory.logicalInitialByte = taskDescriptor->pagination.bytesAllocated + 1;
-    taskDescriptor->variable[index].logicalMemory.logicalFinalByte = taskDescriptor->pagination.bytesAllocated + value;
-    taskDescriptor->pagination.bytesAllocated += value;
-    taskDescriptor->pagination.finalPage = roundingNumber((float) taskDescriptor->pagination.bytesAllocated / LOGICAL_PHYSICAL_PAGE_SIZE);
-}//updateLogicalMemory()
+void printTextReport(FILE *output, const RoundRobin* roundRobin, const TaskDescriptor tasks[], int numberOfTasks) {
+    printRoundRobin(output, roundRobin, numberOfTasksPerformedSuccessfully(tasks, numberOfTasks));
+    printTasks(output, tasks, numberOfTasks, roundRobin);
+}//printTextReport()
 
-/* Atualiza a memória física de uma variável de uma tarefa.
-   Esta função atualiza os endereços físicos de uma variável da tarefa com base no valor alocado.
-   Calcula os endereços físicos inicial e final da variável.
+/* Imprime a identificação de um cenário do modo em lote no formato texto.
    Parâmetros:
-   - taskDescriptor: Ponteiro para o descritor de tarefa (TaskDescriptor).
-   - index: Índice da variável no array de variáveis da tarefa.
-   - value: Valor alocado para a variável.
+   - output: Saída do relatório.
+   - number: Número do cenário, a partir de 1.
+   - description: Linha da lista de cenários.
 */
-void updatePhysicalMemory(TaskDescriptor* taskDescriptor, int index, int value) {
-    taskDescriptor->variable[index].physicalMemory.physicalInitialByte = taskDescriptor->pagination.physicalBytesAllocated + 1;
-    taskDescriptor->variable[index].physicalMemory.physicalFinalByte = taskDescriptor->pagination.physicalBytesAllocated + value;
-    taskDescriptor->pagination.physicalBytesAllocated += value;
-}//updatePhysicalMemory()
+void printTextScenarioHeader(FILE *output, int number, const char *description) {
+    fprintf(output, BATCH_SCENARIO_HEADER, number, description);
+}//printTextScenarioHeader()
 
-/* Executa a instrução 'new' para simular a alocação de variáveis para uma tarefa.
-   Esta função analisa a instrução, identifica a variável e seu valor alocado.
-   Em seguida, verifica se a variável já foi declarada. Se não, aloca a variável na memória lógica e física da tarefa.
+/* Imprime uma cadeia de caracteres como string JSON, entre aspas e com os caracteres especiais escapados.
    Parâmetros:
-   - instruction: Instrução a ser executada.
-   - taskDescriptor: Ponteiro para o descritor de tarefa (TaskDescriptor).
-   - roundRobin: Ponteiro para a estrutura RoundRobin contendo informações do sistema.
-   Retorno:
-   - TRUE se a alocação da variável for bem-sucedida, FALSE caso contrário.
+   - output: Saída do relatório.
+   - text: Cadeia de caracteres (UTF-8).
 */
-boolean new(String instruction, TaskDescriptor* taskDescriptor, RoundRobin* roundRobin) {
-    String identifier;
-    int value;
-    sscanf(instruction, "%s new %d", identifier, &value);
-    for (int i = 0; i < MAXIMUN_NUMBER_OF_VARIABLES; i++) {
-        // Verifica se já tem a variável alocada
-        if (strcmp(identifier, taskDescriptor->variable[i].name) == 0){
-            printf(IDENTIFY_ALREADY_DECLARED_ERROR, taskDescriptor->task.nameOfTask, identifier);
-            finishTask(taskDescriptor, TRUE, roundRobin);
-            return FALSE;
+void printJsonString(FILE *output, const char *text) {
+    fputc('"', output);
+    for (const unsigned char *c = (const unsigned char*) text; *c != NULL_CHAR; c++) {
+        if (*c == '"' || *c == '\\') {
+            fputc('\\', output);
+            fputc(*c, output);
         }
-        
-        if (strlen(taskDescriptor->variable[i].name) == 0) {
-            taskDescriptor->variable[i].value = value;
-            strcpy(taskDescriptor->variable[i].name, identifier);
-            updateLogicalMemory(taskDescriptor, i, taskDescriptor->variable[i].value);
-            updatePhysicalMemory(taskDescriptor, i, taskDescriptor->variable[i].value);
-
-            if (taskDescriptor->pagination.bytesAllocated > LARGEST_LOGICAL_MEMORY_SIZE) {
-                printf(ALLOCATION_SPACE_ERROR, taskDescriptor->task.nameOfTask, LARGEST_LOGICAL_MEMORY_SIZE);
-                finishTask(taskDescriptor, TRUE, roundRobin);
-                return FALSE;
-            }
-            taskDescriptor->quantityVariables++;
-            return TRUE;
+        else if (*c < 0x20) {
+            fprintf(output, "\\u%04x", *c);
+        }
+        else {
+            fputc(*c, output);
         }
     }
-    finishTask(taskDescriptor, TRUE, roundRobin);
-    return FALSE;
-}//new()
+    fputc('"', output);
+}//printJsonString()
 
-/* Imprime os acessos à memória das variáveis de uma tarefa.
-   Esta função percorre os acessos à memória registrados na estrutura da tarefa e imprime os endereços lógicos e físicos
-   para cada acesso.
+/* Imprime um número JSON com duas casas decimais, ou null quando o valor não é finito (por exemplo, médias sem tarefas).
    Parâmetros:
-   - taskDesc: Descritor da tarefa (TaskDescriptor) contendo os acessos à memória.
+   - output: Saída do relatório.
+   - value: Valor a ser impresso.
 */
-void printTaskMemoryAccesses(TaskDescriptor taskDesc) {
-      for (int i = 0; i < taskDesc.quantityAccesses; ++i) {
-        int logicalPage = (taskDesc.accesses[i].logicalMemory.logicalInitialByte + taskDesc.accesses[i].value) / LOGICAL_PHYSICAL_PAGE_SIZE; 
-        int physicalPage = (taskDesc.accesses[i].physicalMemory.physicalInitialByte + taskDesc.accesses[i].value) / LOGICAL_PHYSICAL_PAGE_SIZE;
-
-        int logicalByte = (taskDesc.accesses[i].logicalMemory.logicalInitialByte + taskDesc.accesses[i].value) % LOGICAL_PHYSICAL_PAGE_SIZE; 
-        int physicalByte = (taskDesc.accesses[i].physicalMemory.physicalInitialByte + taskDesc.accesses[i].value) % LOGICAL_PHYSICAL_PAGE_SIZE;
-
-        printf("\n\t\t%s[%d] -> Endereço Lógico = %d : %d\n", taskDesc.accesses[i].name, taskDesc.accesses[i].value, logicalPage, logicalByte);
-        printf("\t\t-> Endereço Físico = %d : %d\n", physicalPage, physicalByte);
+void printJsonNumber(FILE *output, double value) {
+    if (isfinite(value)) {
+        fprintf(output, "%.2f", value);
     }
-}//printTaskMemoryAccesses()
+    else {
+        fputs("null", output);
+    }
+}//printJsonNumber()
 
-/* Simula um acesso à memória de uma variável.
-   Esta função analisa a instrução fornecida para acessar a memória de uma variável específica da tarefa.
-   Se a variável for encontrada, o acesso à memória é registrado no descritor da tarefa.
+/* Imprime os campos que identificam uma simulação, compartilhados pelas linhas JSON da simulação e das suas tarefas.
    Parâmetros:
-   - instruction: Instrução de acesso à memória.
-   - taskDescriptor: Ponteiro para o descritor da tarefa (TaskDescriptor).
-   - roundRobin: Ponteiro para a estrutura RoundRobin contendo informações do sistema.
+   - output: Saída do relatório.
+   - roundRobin: Estrutura RoundRobin contendo informações do sistema.
+*/
+void printJsonSimulationFields(FILE *output, const RoundRobin* roundRobin) {
+    fputs("\"politica\":", output);
+    printJsonString(output, roundRobin->policyName != NULL ? roundRobin->policyName : "Round-Robin");
+    fputs(",\"substituicao\":", output);
+    if (roundRobin->frameAllocator.replacement != NULL) {
+        printJsonString(output, roundRobin->frameAllocator.replacement->displayName);
+    }
+    else {
+        fputs("null", output);
+    }
+    fprintf(output, ",\"pagina\":%u,\"memoria_fisica\":%u,\"memoria_logica\":%u,\"quantum\":%u,\"nucleos\":%u,\"tlb_entradas\":%u",
+        roundRobin->machine.pageSize, roundRobin->machine.physicalMemorySize, roundRobin->machine.logicalMemorySize,
+        roundRobin->machine.quantum, roundRobin->numberOfCores, roundRobin->tlb.entries);
+}//printJsonSimulationFields()
+
+/* Imprime uma tarefa como uma linha JSON, com as variáveis e a tabela de páginas (null nas páginas não residentes).
+   Os acessos à memória não são listados, apenas contados.
+   Parâmetros:
+   - output: Saída do relatório.
+   - taskDesc: Descritor de tarefa (TaskDescriptor).
+   - roundRobin: Estrutura RoundRobin contendo informações do sistema.
+*/
+void printJsonTask(FILE *output, const TaskDescriptor* taskDesc, const RoundRobin* roundRobin) {
+    const TaskMemory* memory = taskDesc->memory;
+    fputs("{\"tipo\":\"tarefa\",", output);
+    printJsonSimulationFields(output, roundRobin);
+    fputs(",\"tarefa\":", output);
+    printJsonString(output, taskDesc->task->nameOfTask);
+    fprintf(output, ",\"abortada\":%s", taskDesc->aborted ? "true" : "false");
+    if (taskDesc->aborted) {
+        fputs("}\n", output);
+        return;
+    }
+    fprintf(output, ",\"tempo_cpu\":%u,\"tempo_es\":%u,\"inicio\":%u,\"fim\":%u,\"taxa_cpu\":",
+        taskDesc->cpuTime, taskDesc->inputOutputTime, taskDesc->startTime, taskDesc->endTime);
+    printJsonNumber(output, calculateCPURate(taskDesc, roundRobin));
+    fputs(",\"taxa_disco\":", output);
+    printJsonNumber(output, calculateDiskRate(taskDesc, roundRobin));
+    fprintf(output, ",\"paginas_logicas\":%u,\"faltas_pagina\":%u,\"acessos_memoria\":%llu,\"tlb_acertos\":%llu,\"tlb_faltas\":%llu",
+        memory->pagination.mappedPages, memory->pageFaults, memory->accessLog.numberOfAccesses, memory->tlbHits, memory->tlbMisses);
+
+    fputs(",\"variaveis\":[", output);
+    for (unsigned int i = 0; i < memory->quantityVariables; ++i) {
+        const Variable* var = &memory->variables[i];
+        fputs(i > 0 ? ",{\"nome\":" : "{\"nome\":", output);
+        printJsonString(output, var->name);
+        fprintf(output, ",\"inicio_logico\":%u,\"fim_logico\":%u}", var->logicalMemory.logicalInitialByte, var->logicalMemory.logicalFinalByte);
+    }
+    fputs("],\"tabela_paginas\":[", output);
+    for (unsigned int i = 0; i < memory->pagination.mappedPages; ++i) {
+        if (i > 0) {
+            fputc(COMMA, output);
+        }
+        if (memory->pagination.frames[i] == NO_FRAME) {
+            fputs("null", output);
+        }
+        else {
+            fprintf(output, "%u", memory->pagination.frames[i]);
+        }
+    }
+    fputs("]}\n", output);
+}//printJsonTask()
+
+/* Imprime o relatório de uma simulação no formato JSON Lines: uma linha com as métricas da simulação e uma linha
+   por tarefa, inclusive as abortadas. Os números usam sempre o ponto decimal, qualquer que seja a região da thread.
+   Parâmetros:
+   - output: Saída do relatório.
+   - roundRobin: Estrutura RoundRobin contendo informações do sistema.
+   - tasks: Array de descritores de tarefa.
+   - numberOfTasks: Número total de tarefas no array.
+*/
+void printJsonlReport(FILE *output, const RoundRobin* roundRobin, const TaskDescriptor tasks[], int numberOfTasks) {
+    locale_t previousLocale = uselocale(LC_GLOBAL_LOCALE);
+    int successfully = numberOfTasksPerformedSuccessfully(tasks, numberOfTasks);
+
+    fputs("{\"tipo\":\"simulacao\",", output);
+    printJsonSimulationFields(output, roundRobin);
+    fputs(",\"tempo_medio_execucao\":", output);
+    printJsonNumber(output, (double) roundRobin->totalCPUClocks / successfully);
+    fputs(",\"tempo_medio_espera\":", output);
+    printJsonNumber(output, (double) roundRobin->waitTime / successfully);
+    fprintf(output, ",\"vazao\":%.4f,\"tempo_ocioso\":%u,\"taxa_ociosidade\":",
+        roundRobin->totalCPUClocks > 0 ? (double) successfully / roundRobin->totalCPUClocks : 0.0, roundRobin->idleTime);
+    printJsonNumber(output, calculateIdleRate(roundRobin));
+    fprintf(output, ",\"tarefas_concluidas\":%d,\"tarefas_abortadas\":%u,\"quadros_pico\":%u,\"quadros_disponiveis\":%u,\"esperas_memoria\":%u",
+        successfully, roundRobin->abortedTasks, roundRobin->frameAllocator.peakFramesInUse,
+        roundRobin->machine.numberOfFrames - roundRobin->machine.reservedFrames, roundRobin->memoryWaits);
+    fprintf(output, ",\"limite_programas\":%u,\"programas_residentes_pico\":%u,\"recargas_programa\":%llu",
+        roundRobin->residentProgramLimit, roundRobin->peakResidentPrograms, roundRobin->programReloads);
+    fprintf(output, ",\"acessos_memoria\":%llu,\"faltas_pagina\":%llu,\"substituicoes\":%llu",
+        roundRobin->memoryAccesses, roundRobin->pageFaults, roundRobin->pageReplacements);
+    fprintf(output, ",\"tlb_acertos\":%llu,\"tlb_faltas\":%llu,\"tlb_esvaziamentos\":%llu,\"migracoes\":%u,\"nucleos_ocupacao\":[",
+        roundRobin->tlbHits, roundRobin->tlbMisses, roundRobin->tlbFlushes, roundRobin->migrations);
+    for (unsigned int i = 0; i < roundRobin->numberOfCores; i++) {
+        if (i > 0) {
+            fputc(COMMA, output);
+        }
+        printJsonNumber(output, calculateCoreCPURate(roundRobin, i));
+    }
+    fputs("]}\n", output);
+
+    for (int i = 0; i < numberOfTasks; i++) {
+        printJsonTask(output, &tasks[i], roundRobin);
+    }
+    uselocale(previousLocale);
+}//printJsonlReport()
+
+/* Imprime a identificação de um cenário do modo em lote como uma linha JSON.
+   Parâmetros:
+   - output: Saída do relatório.
+   - number: Número do cenário, a partir de 1.
+   - description: Linha da lista de cenários.
+*/
+void printJsonlScenarioHeader(FILE *output, int number, const char *description) {
+    fprintf(output, "{\"tipo\":\"cenario\",\"numero\":%d,\"descricao\":", number);
+    printJsonString(output, description);
+    fputs("}\n", output);
+}//printJsonlScenarioHeader()
+
+/* Imprime um campo CSV, entre aspas (com as aspas internas duplicadas) quando contém vírgula, aspas ou quebra de linha.
+   Parâmetros:
+   - output: Saída do relatório.
+   - text: Conteúdo do campo.
+*/
+void printCsvField(FILE *output, const char *text) {
+    if (strpbrk(text, ",\"\r\n") == NULL) {
+        fputs(text, output);
+        return;
+    }
+    fputc('"', output);
+    for (const char *c = text; *c != NULL_CHAR; c++) {
+        if (*c == '"') {
+            fputc('"', output);
+        }
+        fputc(*c, output);
+    }
+    fputc('"', output);
+}//printCsvField()
+
+/* Imprime a linha de cabeçalho do formato CSV.
+   Parâmetros:
+   - output: Saída do relatório.
+*/
+void printCsvHeader(FILE *output) {
+    fputs(CSV_REPORT_HEADER, output);
+}//printCsvHeader()
+
+/* Imprime o relatório de uma simulação no formato CSV: uma linha por tarefa, inclusive as abortadas, com as colunas
+   de CSV_REPORT_HEADER. As taxas sem valor definido ficam vazias, e os números usam sempre o ponto decimal.
+   Parâmetros:
+   - output: Saída do relatório.
+   - roundRobin: Estrutura RoundRobin contendo informações do sistema.
+   - tasks: Array de descritores de tarefa.
+   - numberOfTasks: Número total de tarefas no array.
+*/
+void printCsvReport(FILE *output, const RoundRobin* roundRobin, const TaskDescriptor tasks[], int numberOfTasks) {
+    locale_t previousLocale = uselocale(LC_GLOBAL_LOCALE);
+    for (int i = 0; i < numberOfTasks; i++) {
+        const TaskDescriptor* taskDesc = &tasks[i];
+        const TaskMemory* memory = taskDesc->memory;
+        printCsvField(output, roundRobin->policyName != NULL ? roundRobin->policyName : "Round-Robin");
+        fputc(COMMA, output);
+        printCsvField(output, roundRobin->frameAllocator.replacement != NULL ? roundRobin->frameAllocator.replacement->displayName : "");
+        fprintf(output, ",%u,%u,%u,%u,%u,%u,", roundRobin->machine.pageSize, roundRobin->machine.physicalMemorySize,
+            roundRobin->machine.logicalMemorySize, roundRobin->machine.quantum, roundRobin->numberOfCores, roundRobin->tlb.entries);
+        printCsvField(output, taskDesc->task->nameOfTask);
+        if (taskDesc->aborted) {
+            fputs(",1,,,,,,,,,,,\n", output);
+            continue;
+        }
+        float cpuRate = calculateCPURate(taskDesc, roundRobin);
+        float diskRate = calculateDiskRate(taskDesc, roundRobin);
+        fprintf(output, ",0,%u,%u,%u,%u,", taskDesc->cpuTime, taskDesc->inputOutputTime, taskDesc->startTime, taskDesc->endTime);
+        if (isfinite(cpuRate)) {
+            fprintf(output, "%.2f", cpuRate);
+        }
+        fputc(COMMA, output);
+        if (isfinite(diskRate)) {
+            fprintf(output, "%.2f", diskRate);
+        }
+        fprintf(output, ",%u,%u,%llu,%llu,%llu\n", memory->pagination.mappedPages, memory->pageFaults,
+            memory->accessLog.numberOfAccesses, memory->tlbHits, memory->tlbMisses);
+    }
+    uselocale(previousLocale);
+}//printCsvReport()
+
+// Formatos de relatório disponíveis na linha de comando.
+const ReportFormat REPORT_FORMATS[NUMBER_OF_REPORT_FORMATS] = {
+    {"texto", FALSE, NULL, printTextScenarioHeader, printTextReport},
+    {"jsonl", TRUE, NULL, printJsonlScenarioHeader, printJsonlReport},
+    {"csv", TRUE, printCsvHeader, NULL, printCsvReport}
+};
+
+/* Procura um formato de relatório pelo nome usado na linha de comando.
+   Parâmetros:
+   - name: Nome do formato.
+   Retorno:
+   - Ponteiro para o formato, ou NULL se o nome for desconhecido.
+*/
+const ReportFormat* findReportFormat(const char *name) {
+    for (int i = 0; i < NUMBER_OF_REPORT_FORMATS; i++) {
+        if (strcmp(REPORT_FORMATS[i].name, name) == 0) {
+            return &REPORT_FORMATS[i];
+        }
+    }
+    return NULL;
+}//findReportFormat()
+
+/* Calcula os valores derivados da geometria de memória e verifica se ela é válida.
+   A memória reservada ocupa os primeiros quadros, arredondada para cima; os quadros restantes precisam
+   comportar todas as páginas de uma tarefa, para que a admissão de uma tarefa nunca espere para sempre.
+   Parâmetros:
+   - machine: Geometria com o tamanho de página e os tamanhos das memórias física e lógica já definidos.
+   Retorno:
+   - TRUE se a geometria é válida, FALSE caso contrário.
+*/
+boolean configureMachine(MachineConfiguration* machine) {
+    if (machine->pageSize < MINIMUM_PAGE_SIZE) {
+        return FALSE;
+    }
+    machine->pageSizeIsPowerOfTwo = (machine->pageSize & (machine->pageSize - 1)) == 0;
+    machine->pageShift = machine->pageSizeIsPowerOfTwo ? (unsigned int) __builtin_ctz(machine->pageSize) : 0;
+    machine->pageMask = machine->pageSizeIsPowerOfTwo ? machine->pageSize - 1 : 0;
+    machine->numberOfFrames = machine->physicalMemorySize / machine->pageSize;
+    machine->reservedFrames = (RESERVED_PROGRAM_MEMORY_SIZE + machine->pageSize - 1) / machine->pageSize;
+    machine->maximumNumberOfPages = machine->logicalMemorySize / machine->pageSize + 1;
+    return machine->numberOfFrames <= MAXIMUM_NUMBER_OF_FRAMES
+        && machine->numberOfFrames > machine->reservedFrames
+        && machine->numberOfFrames - machine->reservedFrames >= machine->maximumNumberOfPages;
+}//configureMachine()
+
+/* Calcula a página de um endereço lógico ou o quadro de um endereço físico.
+   Parâmetros:
+   - machine: Geometria de memória.
+   - address: Endereço, em bytes.
+   Retorno:
+   - Número da página (ou do quadro).
+*/
+unsigned int addressPage(const MachineConfiguration* machine, unsigned int address) {
+    if (machine->pageSizeIsPowerOfTwo) {
+        return address >> machine->pageShift;
+    }
+    return address / machine->pageSize;
+}//addressPage()
+
+/* Calcula o deslocamento de um endereço dentro da sua página.
+   Parâmetros:
+   - machine: Geometria de memória.
+   - address: Endereço, em bytes.
+   Retorno:
+   - Deslocamento, em bytes, a partir do início da página.
+*/
+unsigned int addressOffset(const MachineConfiguration* machine, unsigned int address) {
+    if (machine->pageSizeIsPowerOfTwo) {
+        return address & machine->pageMask;
+    }
+    return address % machine->pageSize;
+}//addressOffset()
+
+/* Calcula o endereço do primeiro byte de uma página ou de um quadro.
+   Parâmetros:
+   - machine: Geometria de memória.
+   - page: Número da página (ou do quadro).
+   Retorno:
+   - Endereço inicial, em bytes.
+*/
+unsigned int pageAddress(const MachineConfiguration* machine, unsigned int page) {
+    if (machine->pageSizeIsPowerOfTwo) {
+        return page << machine->pageShift;
+    }
+    return page * machine->pageSize;
+}//pageAddress()
+
+/* Inicializa o alocador de quadros, marcando como livres todos os quadros fora da memória reservada.
+   O mapa de bits e os quadros são alocados conforme a geometria de memória da simulação.
+   Parâmetros:
+   - allocator: Alocador de quadros a ser inicializado.
+   - machine: Geometria de memória, mantida pelo chamador durante a simulação.
+*/
+void initializeFrameAllocator(FrameAllocator* allocator, const MachineConfiguration* machine) {
+    memset(allocator, 0, sizeof(FrameAllocator));
+    allocator->machine = machine;
+    allocator->bitmapWords = (machine->numberOfFrames + 63) / 64;
+    allocator->freeFrames = (unsigned long long*)calloc(allocator->bitmapWords, sizeof(unsigned long long));
+    allocator->frames = (PhysicalFrame*)calloc(machine->numberOfFrames, sizeof(PhysicalFrame));
+    for (unsigned int frame = machine->reservedFrames; frame < machine->numberOfFrames; frame++) {
+        allocator->freeFrames[frame / 64] |= 1ULL << (frame % 64);
+    }
+    allocator->numberOfFreeFrames = machine->numberOfFrames - machine->reservedFrames;
+    allocator->clockHand = machine->reservedFrames;
+}//initializeFrameAllocator()
+
+/* Libera o mapa de bits e os quadros do alocador; as estatísticas continuam disponíveis para o relatório.
+   Parâmetros:
+   - allocator: Alocador de quadros.
+*/
+void destroyFrameAllocator(FrameAllocator* allocator) {
+    free(allocator->freeFrames);
+    free(allocator->frames);
+    allocator->freeFrames = NULL;
+    allocator->frames = NULL;
+}//destroyFrameAllocator()
+
+/* Retira do mapa de bits o quadro livre de menor número.
+   Parâmetros:
+   - allocator: Alocador de quadros.
+   Retorno:
+   - Número do quadro alocado, ou NO_FRAME se não houver quadros livres.
+*/
+unsigned int allocateFrame(FrameAllocator* allocator) {
+    for (unsigned int word = 0; word < allocator->bitmapWords; word++) {
+        unsigned long long bits = allocator->freeFrames[word];
+        if (bits != 0) {
+            allocator->freeFrames[word] = bits & (bits - 1);
+            allocator->numberOfFreeFrames--;
+            unsigned int framesInUse = allocator->machine->numberOfFrames - allocator->machine->reservedFrames - allocator->numberOfFreeFrames;
+            if (framesInUse > allocator->peakFramesInUse) {
+                allocator->peakFramesInUse = framesInUse;
+            }
+            return word * 64 + __builtin_ctzll(bits);
+        }
+    }
+    return NO_FRAME;
+}//allocateFrame()
+
+/* Devolve um quadro ao mapa de quadros livres.
+   Parâmetros:
+   - allocator: Alocador de quadros.
+   - frame: Número do quadro liberado.
+*/
+void releaseFrame(FrameAllocator* allocator, unsigned int frame) {
+    allocator->freeFrames[frame / 64] |= 1ULL << (frame % 64);
+    allocator->numberOfFreeFrames++;
+    allocator->frames[frame].owner = NULL;
+}//releaseFrame()
+
+/* Carrega uma página da tarefa em um quadro, atualizando a tabela de páginas e os dados do quadro.
+   Parâmetros:
+   - allocator: Alocador de quadros.
+   - frame: Quadro que recebe a página.
+   - taskDescriptor: Descritor da tarefa dona da página.
+   - page: Página lógica carregada.
+*/
+void installPage(FrameAllocator* allocator, unsigned int frame, TaskDescriptor* taskDescriptor, unsigned int page) {
+    PhysicalFrame* physicalFrame = &allocator->frames[frame];
+    taskDescriptor->memory->pagination.frames[page] = frame;
+    physicalFrame->owner = taskDescriptor;
+    physicalFrame->page = page;
+    physicalFrame->loadTime = allocator->references;
+    physicalFrame->lastUse = allocator->references;
+    physicalFrame->referenced = TRUE;
+}//installPage()
+
+/* Traduz um endereço lógico da tarefa para o endereço físico, pela tabela de páginas.
+   Parâmetros:
+   - taskDescriptor: Descritor da tarefa.
+   - machine: Geometria de memória.
+   - logicalByte: Endereço lógico, em uma página já mapeada.
+   Retorno:
+   - Endereço físico correspondente.
+*/
+unsigned int translateAddress(const TaskDescriptor* taskDescriptor, const MachineConfiguration* machine, unsigned int logicalByte) {
+    unsigned int frame = taskDescriptor->memory->pagination.frames[addressPage(machine, logicalByte)];
+    return pageAddress(machine, frame) + addressOffset(machine, logicalByte);
+}//translateAddress()
+
+/* Calcula quantas páginas a tarefa terá mapeadas no pico de uso da memória.
+   Percorre o programa aplicando as mesmas regras de 'header()' e 'new()', até a primeira instrução que excederia
+   a memória lógica (e abortaria a tarefa).
+   Parâmetros:
+   - program: Programa da tarefa.
+   - machine: Geometria de memória.
+   Retorno:
+   - Número de páginas lógicas que a tarefa chega a mapear.
+*/
+unsigned int countRequiredPages(const TaskProgram* program, const MachineConfiguration* machine) {
+    unsigned int bytesAllocated = 0;
+    unsigned int pages = 0;
+    for (unsigned int i = 0; i < program->numberOfInstructions; i++) {
+        ParsedInstruction instruction;
+        unsigned int lastByte;
+        fetchInstruction(program, i, &instruction);
+        if (instruction.type == HEADER) {
+            if (instruction.value > machine->logicalMemorySize) {
+                break;
+            }
+            if (instruction.value == 0) {
+                bytesAllocated = 0;
+                continue;
+            }
+            lastByte = instruction.value - 1;
+            bytesAllocated = roundingNumber((float) instruction.value / machine->pageSize) * machine->pageSize - 1;
+        }
+        else if (instruction.type == NEW) {
+            if (instruction.value > machine->logicalMemorySize - bytesAllocated) {
+                break;
+            }
+            lastByte = bytesAllocated + (instruction.value > 0 ? instruction.value : 1);
+            bytesAllocated += instruction.value;
+        }
+        else {
+            continue;
+        }
+        if (addressPage(machine, lastByte) + 1 > pages) {
+            pages = addressPage(machine, lastByte) + 1;
+        }
+    }
+    return pages;
+}//countRequiredPages()
+
+/* Admite uma tarefa na memória física, reservando os quadros do seu pico de uso.
+   Parâmetros:
+   - taskDescriptor: Descritor da tarefa.
+   - allocator: Alocador de quadros.
+   - frames: Quantidade de quadros reservados.
+*/
+void reserveTaskFrames(TaskDescriptor* taskDescriptor, FrameAllocator* allocator, unsigned int frames) {
+    taskDescriptor->memoryAdmitted = TRUE;
+    taskDescriptor->framesReserved = frames;
+    allocator->numberOfReservedFrames += frames;
+}//reserveTaskFrames()
+
+/* Mapeia, página a página, as páginas lógicas da tarefa até a que contém o byte informado.
+   Na paginação sob demanda as páginas entram na tabela sem quadro e só são carregadas no primeiro acesso.
+   Caso contrário, os quadros vêm do alocador e não precisam ser contíguos. No primeiro mapeamento a tarefa é admitida na memória física:
+   os quadros do seu pico de uso são reservados, de modo que os mapeamentos seguintes nunca esperam. Se não houver
+   quadros livres para a reserva, ou se outras tarefas já esperam, a tarefa é suspensa na fila de espera por memória,
+   sem ocupar quadros, e a instrução será repetida ao despertar. A tabela de páginas cresce conforme as páginas mapeadas.
+   Parâmetros:
+   - taskDescriptor: Descritor da tarefa.
+   - lastByte: Último byte lógico que precisa estar mapeado.
+   - scheduler: Ponteiro para o escalonador, com a fila de espera por memória.
+   - roundRobin: Ponteiro para a estrutura RoundRobin, com o alocador de quadros.
+   Retorno:
+   - TRUE se as páginas estão mapeadas, FALSE se a tarefa foi suspensa à espera de quadros
+     ou abortada por falta de memória para a tabela de páginas.
+*/
+boolean mapTaskPages(TaskDescriptor* taskDescriptor, unsigned int lastByte, Scheduler* scheduler, RoundRobin* roundRobin) {
+    Pagination* pagination = &taskDescriptor->memory->pagination;
+    FrameAllocator* allocator = &roundRobin->frameAllocator;
+    unsigned int pages = addressPage(&roundRobin->machine, lastByte) + 1;
+    if (pages <= pagination->mappedPages) {
+        return TRUE;
+    }
+
+    if (pages > pagination->pageTableCapacity) {
+        unsigned int capacity = pagination->pageTableCapacity * 2 > pages ? pagination->pageTableCapacity * 2 : pages;
+        unsigned int *frames = (unsigned int*)realloc(pagination->frames, capacity * sizeof(unsigned int));
+        if (frames == NULL) {
+            finishTask(taskDescriptor, TRUE, roundRobin);
+            return FALSE;
+        }
+        pagination->frames = frames;
+        pagination->pageTableCapacity = capacity;
+    }
+
+    if (allocator->replacement != NULL) {
+        while (pagination->mappedPages < pages) {
+            pagination->frames[pagination->mappedPages++] = NO_FRAME;
+        }
+        return TRUE;
+    }
+
+    if (!taskDescriptor->memoryAdmitted) {
+        unsigned int framesWanted = countRequiredPages(&taskDescriptor->task->program, &roundRobin->machine);
+        if (!isTaskDescriptorQueueEmpty(scheduler->memoryWaitQueue)
+            || framesWanted > allocator->numberOfFreeFrames - allocator->numberOfReservedFrames) {
+            taskDescriptor->framesWanted = framesWanted;
+            taskDescriptor->wakeUpTime = roundRobin->coreClock + roundRobin->preemptionTimeCounter - UT;
+            roundRobin->memoryWaits++;
+            changeTaskStatus(taskDescriptor, SUSPENDED, roundRobin);
+            enqueueTaskDescriptor(scheduler->memoryWaitQueue, taskDescriptor);
+            return FALSE;
+        }
+        reserveTaskFrames(taskDescriptor, allocator, framesWanted);
+    }
+    while (pagination->mappedPages < pages) {
+        taskDescriptor->framesReserved--;
+        allocator->numberOfReservedFrames--;
+        installPage(allocator, allocateFrame(allocator), taskDescriptor, pagination->mappedPages++);
+    }
+    return TRUE;
+}//mapTaskPages()
+
+/* Devolve ao alocador os quadros e a reserva restante de uma tarefa finalizada.
+   A tabela de páginas é mantida, pois o relatório da tarefa mostra o mapeamento usado na execução.
+   Parâmetros:
+   - taskDescriptor: Descritor da tarefa.
+   - allocator: Alocador de quadros.
+*/
+void releaseTaskFrames(TaskDescriptor* taskDescriptor, FrameAllocator* allocator) {
+    for (unsigned int i = 0; i < taskDescriptor->memory->pagination.mappedPages; i++) {
+        if (taskDescriptor->memory->pagination.frames[i] != NO_FRAME) {
+            releaseFrame(allocator, taskDescriptor->memory->pagination.frames[i]);
+        }
+    }
+    allocator->numberOfReservedFrames -= taskDescriptor->framesReserved;
+    taskDescriptor->framesReserved = 0;
+}//releaseTaskFrames()
+
+/* Escolhe a página carregada há mais tempo (FIFO).
+   Parâmetros:
+   - allocator: Alocador de quadros, sem quadros livres.
+   Retorno:
+   - Quadro da página substituída.
+*/
+unsigned int selectFifoVictim(FrameAllocator* allocator) {
+    unsigned int victim = NO_FRAME;
+    for (unsigned int frame = allocator->machine->reservedFrames; frame < allocator->machine->numberOfFrames; frame++) {
+        if (allocator->frames[frame].owner != NULL
+            && (victim == NO_FRAME || allocator->frames[frame].loadTime < allocator->frames[victim].loadTime)) {
+            victim = frame;
+        }
+    }
+    return victim;
+}//selectFifoVictim()
+
+/* Escolhe a página referenciada há mais tempo (LRU).
+   Parâmetros:
+   - allocator: Alocador de quadros, sem quadros livres.
+   Retorno:
+   - Quadro da página substituída.
+*/
+unsigned int selectLruVictim(FrameAllocator* allocator) {
+    unsigned int victim = NO_FRAME;
+    for (unsigned int frame = allocator->machine->reservedFrames; frame < allocator->machine->numberOfFrames; frame++) {
+        if (allocator->frames[frame].owner != NULL
+            && (victim == NO_FRAME || allocator->frames[frame].lastUse < allocator->frames[victim].lastUse)) {
+            victim = frame;
+        }
+    }
+    return victim;
+}//selectLruVictim()
+
+/* Escolhe a página pela política do relógio (segunda chance).
+   O ponteiro percorre os quadros circularmente: páginas referenciadas perdem o bit de referência e ganham
+   uma segunda chance, e a primeira página sem o bit é substituída.
+   Parâmetros:
+   - allocator: Alocador de quadros, sem quadros livres.
+   Retorno:
+   - Quadro da página substituída.
+*/
+unsigned int selectClockVictim(FrameAllocator* allocator) {
+    while (TRUE) {
+        unsigned int frame = allocator->clockHand;
+        allocator->clockHand = frame + 1 < allocator->machine->numberOfFrames ? frame + 1 : allocator->machine->reservedFrames;
+        PhysicalFrame* physicalFrame = &allocator->frames[frame];
+        if (physicalFrame->owner == NULL) {
+            continue;
+        }
+        if (!physicalFrame->referenced) {
+            return frame;
+        }
+        physicalFrame->referenced = FALSE;
+    }
+}//selectClockVictim()
+
+/* Calcula quantas instruções faltam para a tarefa acessar novamente uma página.
+   Percorre o programa a partir da próxima instrução, recarregando-o se foi descartado; acessos a variáveis ainda
+   não declaradas não são considerados, e uma página de programa que não pôde ser recarregado não é mais acessada.
+   Parâmetros:
+   - taskDescriptor: Descritor da tarefa dona da página.
+   - machine: Geometria de memória.
+   - page: Página lógica.
+   Retorno:
+   - Distância, em instruções, até o próximo acesso, ou ULLONG_MAX se a página não for mais acessada.
+*/
+unsigned long long nextPageReference(const TaskDescriptor* taskDescriptor, const MachineConfiguration* machine, unsigned int page) {
+    if (!acquireTaskProgram(taskDescriptor->task)) {
+        return ULLONG_MAX;
+    }
+    const TaskProgram* program = &taskDescriptor->task->program;
+    for (unsigned int i = taskDescriptor->programCounter; i < program->numberOfInstructions; i++) {
+        const ProgramInstruction* instruction = &program->instructions[i];
+        if (instruction->type != MEMORY_ACCESS || taskDescriptor->memory->symbolVariables[instruction->symbol] == UNDECLARED_VARIABLE) {
+            continue;
+        }
+        const Variable* variable = &taskDescriptor->memory->variables[taskDescriptor->memory->symbolVariables[instruction->symbol]];
+        if (instruction->value < variable->value
+            && addressPage(machine, variable->logicalMemory.logicalInitialByte + instruction->value) == page) {
+            return i - taskDescriptor->programCounter;
+        }
+    }
+    return ULLONG_MAX;
+}//nextPageReference()
+
+/* Escolhe a página cujo próximo acesso está mais distante (ótima, de Belady).
+   A política é uma referência: conhece o restante do programa de cada tarefa, e a distância é medida
+   em instruções da própria tarefa dona da página.
+   Parâmetros:
+   - allocator: Alocador de quadros, sem quadros livres.
+   Retorno:
+   - Quadro da página substituída.
+*/
+unsigned int selectOptimalVictim(FrameAllocator* allocator) {
+    unsigned int victim = NO_FRAME;
+    unsigned long long farthest = 0;
+    for (unsigned int frame = allocator->machine->reservedFrames; frame < allocator->machine->numberOfFrames; frame++) {
+        const PhysicalFrame* physicalFrame = &allocator->frames[frame];
+        if (physicalFrame->owner == NULL) {
+            continue;
+        }
+        unsigned long long distance = nextPageReference(physicalFrame->owner, allocator->machine, physicalFrame->page);
+        if (victim == NO_FRAME || distance > farthest) {
+            victim = frame;
+            farthest = distance;
+            if (distance == ULLONG_MAX) {
+                break;
+            }
+        }
+    }
+    return victim;
+}//selectOptimalVictim()
+
+// Políticas de substituição de páginas disponíveis na linha de comando.
+const ReplacementPolicy REPLACEMENT_POLICIES[NUMBER_OF_REPLACEMENT_POLICIES] = {
+    {"fifo", "FIFO", selectFifoVictim},
+    {"lru", "LRU", selectLruVictim},
+    {"clock", "Relógio (segunda chance)", selectClockVictim},
+    {"opt", "Ótima (Belady)", selectOptimalVictim}
+};
+
+/* Procura uma política de substituição de páginas pelo nome usado na linha de comando.
+   Parâmetros:
+   - name: Nome da política.
+   - length: Quantidade de bytes do nome.
+   Retorno:
+   - Ponteiro para a política, ou NULL se o nome for desconhecido.
+*/
+const ReplacementPolicy* findReplacementPolicy(const char *name, size_t length) {
+    for (int i = 0; i < NUMBER_OF_REPLACEMENT_POLICIES; i++) {
+        if (strlen(REPLACEMENT_POLICIES[i].name) == length && strncmp(REPLACEMENT_POLICIES[i].name, name, length) == 0) {
+            return &REPLACEMENT_POLICIES[i];
+        }
+    }
+    return NULL;
+}//findReplacementPolicy()
+
+/* Lê a configuração da TLB no formato entradas[:vias[:lru|fifo[:flush|asid]]].
+   Sem vias, a TLB é totalmente associativa; por padrão a substituição é LRU e a TLB é esvaziada
+   a cada troca de contexto.
+   Parâmetros:
+   - text: Configuração informada na linha de comando.
+   - configuration: Recebe a configuração lida.
+   Retorno:
+   - TRUE se a configuração é válida, FALSE caso contrário.
+*/
+boolean parseTlbConfiguration(const char *text, TlbConfiguration* configuration) {
+    char *end;
+    unsigned long entries = strtoul(text, &end, 10);
+    unsigned long ways = entries;
+    if (end == text || entries < 1 || entries > MAXIMUM_TLB_ENTRIES) {
+        return FALSE;
+    }
+    configuration->replacement = TLB_LRU;
+    configuration->asid = FALSE;
+
+    if (*end == TLB_CONFIGURATION_SEPARATOR) {
+        const char *start = end + 1;
+        ways = strtoul(start, &end, 10);
+        if (end == start || ways < 1 || ways > entries || entries % ways != 0) {
+            return FALSE;
+        }
+    }
+    if (*end == TLB_CONFIGURATION_SEPARATOR) {
+        const char *start = end + 1;
+        size_t length = strcspn(start, ":");
+        if (length == 3 && strncmp(start, "lru", length) == 0) {
+            configuration->replacement = TLB_LRU;
+        }
+        else if (length == 4 && strncmp(start, "fifo", length) == 0) {
+            configuration->replacement = TLB_FIFO;
+        }
+        else {
+            return FALSE;
+        }
+        end = (char*) start + length;
+    }
+    if (*end == TLB_CONFIGURATION_SEPARATOR) {
+        const char *start = end + 1;
+        if (strcmp(start, "asid") == 0) {
+            configuration->asid = TRUE;
+        }
+        else if (strcmp(start, "flush") != 0) {
+            return FALSE;
+        }
+        end = (char*) start + strlen(start);
+    }
+    if (*end != NULL_CHAR) {
+        return FALSE;
+    }
+
+    configuration->entries = (unsigned int) entries;
+    configuration->ways = (unsigned int) ways;
+    return TRUE;
+}//parseTlbConfiguration()
+
+/* Consulta a TLB do núcleo em execução pela tradução de uma página da tarefa, contabilizando o acerto ou a falta.
+   Parâmetros:
+   - scheduler: Ponteiro para o escalonador, com a TLB de cada núcleo.
+   - roundRobin: Estrutura RoundRobin com a configuração da TLB e o núcleo em execução.
+   - taskDescriptor: Descritor da tarefa.
+   - page: Página lógica traduzida.
+   - frame: Recebe o quadro físico em caso de acerto.
+   Retorno:
+   - TRUE se a tradução estava na TLB, FALSE em caso de falta ou se a simulação não usa TLB.
+*/
+boolean lookupTlb(Scheduler* scheduler, RoundRobin* roundRobin, TaskDescriptor* taskDescriptor, unsigned int page, unsigned int *frame) {
+    const TlbConfiguration* configuration = &roundRobin->tlb;
+    if (configuration->entries == 0) {
+        return FALSE;
+    }
+
+    Tlb* tlb = &scheduler->cores[roundRobin->currentCore].tlb;
+    TlbEntry* set = &tlb->entries[(page % (configuration->entries / configuration->ways)) * configuration->ways];
+    tlb->lookups++;
+    for (unsigned int i = 0; i < configuration->ways; i++) {
+        if (set[i].valid && set[i].task == taskDescriptor && set[i].page == page) {
+            set[i].lastUse = tlb->lookups;
+            *frame = set[i].frame;
+            taskDescriptor->memory->tlbHits++;
+            roundRobin->tlbHits++;
+            return TRUE;
+        }
+    }
+    taskDescriptor->memory->tlbMisses++;
+    roundRobin->tlbMisses++;
+    return FALSE;
+}//lookupTlb()
+
+/* Insere na TLB do núcleo em execução a tradução de uma página, obtida da tabela de páginas após uma falta.
+   Uma entrada inválida do conjunto é usada primeiro; caso contrário, a entrada escolhida pela substituição (LRU ou FIFO).
+   Parâmetros:
+   - scheduler: Ponteiro para o escalonador, com a TLB de cada núcleo.
+   - roundRobin: Estrutura RoundRobin com a configuração da TLB e o núcleo em execução.
+   - taskDescriptor: Descritor da tarefa.
+   - page: Página lógica, residente.
+*/
+void insertTlbEntry(Scheduler* scheduler, RoundRobin* roundRobin, TaskDescriptor* taskDescriptor, unsigned int page) {
+    const TlbConfiguration* configuration = &roundRobin->tlb;
+    if (configuration->entries == 0) {
+        return;
+    }
+
+    Tlb* tlb = &scheduler->cores[roundRobin->currentCore].tlb;
+    TlbEntry* set = &tlb->entries[(page % (configuration->entries / configuration->ways)) * configuration->ways];
+    TlbEntry* victim = &set[0];
+    for (unsigned int i = 0; i < configuration->ways && victim->valid; i++) {
+        unsigned long long age = configuration->replacement == TLB_LRU ? set[i].lastUse : set[i].insertedAt;
+        unsigned long long victimAge = configuration->replacement == TLB_LRU ? victim->lastUse : victim->insertedAt;
+        if (!set[i].valid || age < victimAge) {
+            victim = &set[i];
+        }
+    }
+    victim->valid = TRUE;
+    victim->task = taskDescriptor;
+    victim->page = page;
+    victim->frame = taskDescriptor->memory->pagination.frames[page];
+    victim->insertedAt = tlb->lookups;
+    victim->lastUse = tlb->lookups;
+}//insertTlbEntry()
+
+/* Invalida, nas TLBs de todos os núcleos, a tradução de uma página que deixou de estar residente.
+   Parâmetros:
+   - scheduler: Ponteiro para o escalonador, com a TLB de cada núcleo.
+   - roundRobin: Estrutura RoundRobin com a configuração da TLB.
+   - taskDescriptor: Descritor da tarefa dona da página.
+   - page: Página lógica substituída.
+*/
+void invalidateTlbEntry(Scheduler* scheduler, RoundRobin* roundRobin, const TaskDescriptor* taskDescriptor, unsigned int page) {
+    const TlbConfiguration* configuration = &roundRobin->tlb;
+    if (configuration->entries == 0) {
+        return;
+    }
+
+    unsigned int firstEntry = (page % (configuration->entries / configuration->ways)) * configuration->ways;
+    for (unsigned int core = 0; core < scheduler->numberOfCores; core++) {
+        TlbEntry* set = &scheduler->cores[core].tlb.entries[firstEntry];
+        for (unsigned int i = 0; i < configuration->ways; i++) {
+            if (set[i].valid && set[i].task == taskDescriptor && set[i].page == page) {
+                set[i].valid = FALSE;
+            }
+        }
+    }
+}//invalidateTlbEntry()
+
+/* Registra a troca de contexto de um núcleo quando ele passa a executar outra tarefa: sem ASID, a TLB é esvaziada;
+   com ASID, as entradas das outras tarefas são mantidas.
+   Parâmetros:
+   - core: Núcleo que vai executar a tarefa.
+   - roundRobin: Estrutura RoundRobin com a configuração da TLB e a contagem de esvaziamentos.
+   - taskDescriptor: Tarefa despachada para o núcleo.
+*/
+void switchTlbContext(Core* core, RoundRobin* roundRobin, const TaskDescriptor* taskDescriptor) {
+    const TlbConfiguration* configuration = &roundRobin->tlb;
+    if (core->tlb.lastTask == taskDescriptor) {
+        return;
+    }
+
+    INSTRUMENTATION_COUNT(COUNTER_CONTEXT_SWITCHES);
+    if (configuration->entries > 0 && !configuration->asid && core->tlb.lastTask != NULL) {
+        for (unsigned int i = 0; i < configuration->entries; i++) {
+            core->tlb.entries[i].valid = FALSE;
+        }
+        roundRobin->tlbFlushes++;
+    }
+    core->tlb.lastTask = taskDescriptor;
+}//switchTlbContext()
+
+/* Trata a falta de página de uma tarefa, carregando a página em um quadro livre ou, se não houver,
+   no quadro da página escolhida pela política de substituição, que deixa de estar residente e sai das TLBs.
+   Parâmetros:
+   - taskDescriptor: Descritor da tarefa que acessou a página.
+   - page: Página lógica acessada.
+   - scheduler: Ponteiro para o escalonador, com a TLB de cada núcleo.
+   - roundRobin: Estrutura RoundRobin com o alocador de quadros e as estatísticas de paginação.
+*/
+void handlePageFault(TaskDescriptor* taskDescriptor, unsigned int page, Scheduler* scheduler, RoundRobin* roundRobin) {
+    FrameAllocator* allocator = &roundRobin->frameAllocator;
+    unsigned int frame = allocateFrame(allocator);
+    if (frame == NO_FRAME) {
+        frame = allocator->replacement->selectVictim(allocator);
+        PhysicalFrame* victim = &allocator->frames[frame];
+        victim->owner->memory->pagination.frames[victim->page] = NO_FRAME;
+        invalidateTlbEntry(scheduler, roundRobin, victim->owner, victim->page);
+        roundRobin->pageReplacements++;
+    }
+    installPage(allocator, frame, taskDescriptor, page);
+    taskDescriptor->memory->pageFaults++;
+    roundRobin->pageFaults++;
+}//handlePageFault()
+
+/* Atualiza a memória lógica de uma variável de uma tarefa.
+   Esta função atualiza os endereços lógicos de uma variável da tarefa com base no valor alocado.
+   Calcula os endereços lógicos inicial e final, bem como atualiza a página final de paginação da tarefa.
+   Parâmetros:
+   - taskDescriptor: Ponteiro para o descritor de tarefa (TaskDescriptor).
+   - index: Índice da variável no array de variáveis da tarefa.
+   - value: Valor alocado para a variável.
+   - machine: Geometria de memória.
+*/
+void updateLogicalMemory(TaskDescriptor* taskDescriptor, int index, int value, const MachineConfiguration* machine) {
+    taskDescriptor->memory->variables[index].logicalMemory.logicalInitialByte = taskDescriptor->memory->pagination.bytesAllocated + 1;
+    taskDescriptor->memory->variables[index].logicalMemory.logicalFinalByte = taskDescriptor->memory->pagination.bytesAllocated + value;
+    taskDescriptor->memory->pagination.bytesAllocated += value;
+    taskDescriptor->memory->pagination.finalPage = roundingNumber((float) taskDescriptor->memory->pagination.bytesAllocated / machine->pageSize);
+}//updateLogicalMemory()
+
+/* Executa a instrução 'new' para simular a alocação de variáveis para uma tarefa.
+   Esta função recebe a instrução já decodificada, com a variável e seu valor alocado.
+   Em seguida, verifica pelo índice do símbolo, sem comparar nomes, se a variável já foi declarada.
+   Se não, aloca a variável na memória lógica da tarefa e mapeia em quadros físicos as páginas que ela ocupa;
+   não há limite para o número de variáveis. Sem quadros livres, a tarefa espera e a instrução é repetida.
+   Parâmetros:
+   - instruction: Instrução decodificada a ser executada.
+   - taskDescriptor: Ponteiro para o descritor de tarefa (TaskDescriptor).
+   - scheduler: Ponteiro para o escalonador, com a fila de espera por memória.
+   - roundRobin: Ponteiro para a estrutura RoundRobin contendo informações do sistema.
+   Retorno:
+   - TRUE se a alocação da variável for bem-sucedida, FALSE caso contrário.
+*/
+boolean new(const ParsedInstruction* instruction, TaskDescriptor* taskDescriptor, Scheduler* scheduler, RoundRobin* roundRobin) {
+    String identifier;
+    unsigned int value = instruction->value;
+    copyIdentifier(identifier, instruction);
+
+    // Verifica se já tem a variável alocada
+    if (taskDescriptor->memory->symbolVariables[instruction->symbol] != UNDECLARED_VARIABLE) {
+        fprintf(roundRobin->output, IDENTIFY_ALREADY_DECLARED_ERROR, taskDescriptor->task->nameOfTask, identifier);
+        finishTask(taskDescriptor, TRUE, roundRobin);
+        return FALSE;
+    }
+
+    if (taskDescriptor->memory->quantityVariables == taskDescriptor->memory->variablesCapacity) {
+        unsigned int capacity = taskDescriptor->memory->variablesCapacity == 0 ? INITIAL_VARIABLE_CAPACITY : taskDescriptor->memory->variablesCapacity * 2;
+        Variable *variables = (Variable*)realloc(taskDescriptor->memory->variables, capacity * sizeof(Variable));
+        if (variables == NULL) {
+            finishTask(taskDescriptor, TRUE, roundRobin);
+            return FALSE;
+        }
+        taskDescriptor->memory->variables = variables;
+        taskDescriptor->memory->variablesCapacity = capacity;
+    }
+
+    unsigned int bytesAllocated = taskDescriptor->memory->pagination.bytesAllocated;
+    if (value > roundRobin->machine.logicalMemorySize - bytesAllocated) {
+        fprintf(roundRobin->output, ALLOCATION_SPACE_ERROR, taskDescriptor->task->nameOfTask, roundRobin->machine.logicalMemorySize);
+        finishTask(taskDescriptor, TRUE, roundRobin);
+        return FALSE;
+    }
+
+    // A variável ocupa os bytes lógicos seguintes aos já alocados; uma variável vazia ainda precisa do seu endereço inicial.
+    if (!mapTaskPages(taskDescriptor, bytesAllocated + (value > 0 ? value : 1), scheduler, roundRobin)) {
+        return FALSE;
+    }
+
+    unsigned int index = taskDescriptor->memory->quantityVariables;
+    Variable *variable = &taskDescriptor->memory->variables[index];
+    memset(variable, 0, sizeof(Variable));
+    variable->value = value;
+    strcpy(variable->name, identifier);
+    updateLogicalMemory(taskDescriptor, index, variable->value, &roundRobin->machine);
+    taskDescriptor->memory->symbolVariables[instruction->symbol] = index;
+    taskDescriptor->memory->quantityVariables++;
+    return TRUE;
+}//new()
+
+/* Registra um acesso à memória no registro de acessos da tarefa.
+   O registro cresce em blocos encadeados, sem copiar os acessos já registrados.
+   Parâmetros:
+   - accessLog: Registro de acessos da tarefa.
+   - variable: Índice da variável acessada.
+   - offset: Deslocamento acessado dentro da variável.
+   - physicalAddress: Endereço físico acessado.
+   - timestamp: Instante do acesso.
+   Retorno:
+   - TRUE se o acesso foi registrado, FALSE se não houve memória disponível.
+*/
+boolean appendMemoryAccess(MemoryAccessLog* accessLog, unsigned int variable, unsigned int offset, unsigned int physicalAddress, TimeUnit timestamp) {
+    MemoryAccessChunk* chunk = accessLog->tail;
+    if (chunk == NULL || chunk->size == chunk->capacity) {
+        unsigned int capacity = INITIAL_ACCESS_LOG_CHUNK_SIZE;
+        if (chunk != NULL) {
+            capacity = chunk->capacity * 2 > MAXIMUM_ACCESS_LOG_CHUNK_SIZE ? MAXIMUM_ACCESS_LOG_CHUNK_SIZE : chunk->capacity * 2;
+        }
+        MemoryAccessChunk* created = (MemoryAccessChunk*)malloc(sizeof(MemoryAccessChunk) + capacity * sizeof(MemoryAccessRecord));
+        if (created == NULL) {
+            return FALSE;
+        }
+        created->next = NULL;
+        created->size = 0;
+        created->capacity = capacity;
+        if (chunk == NULL) {
+            accessLog->head = created;
+        }
+        else {
+            chunk->next = created;
+        }
+        accessLog->tail = chunk = created;
+    }
+
+    MemoryAccessRecord* record = &chunk->records[chunk->size++];
+    record->variable = variable;
+    record->offset = offset;
+    record->physicalAddress = physicalAddress;
+    record->timestamp = timestamp;
+    accessLog->numberOfAccesses++;
+    return TRUE;
+}//appendMemoryAccess()
+
+/* Libera todos os blocos do registro de acessos à memória.
+   Parâmetros:
+   - accessLog: Registro de acessos a ser liberado.
+*/
+void freeMemoryAccessLog(MemoryAccessLog* accessLog) {
+    MemoryAccessChunk* chunk = accessLog->head;
+    while (chunk != NULL) {
+        MemoryAccessChunk* next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    memset(accessLog, 0, sizeof(MemoryAccessLog));
+}//freeMemoryAccessLog()
+
+/* Imprime os acessos à memória das variáveis de uma tarefa.
+   Esta função percorre, bloco a bloco, o registro de acessos à memória da tarefa e imprime os endereços lógicos e físicos
+   para cada acesso; o endereço físico é o traduzido pela tabela de páginas no instante do acesso.
+   Parâmetros:
+   - output: Saída do relatório.
+   - taskDesc: Descritor da tarefa (TaskDescriptor) contendo os acessos à memória.
+   - machine: Geometria de memória.
+*/
+void printTaskMemoryAccesses(FILE *output, const TaskDescriptor* taskDesc, const MachineConfiguration* machine) {
+    for (const MemoryAccessChunk* chunk = taskDesc->memory->accessLog.head; chunk != NULL; chunk = chunk->next) {
+        for (unsigned int i = 0; i < chunk->size; ++i) {
+            const MemoryAccessRecord* record = &chunk->records[i];
+            const Variable* variable = &taskDesc->memory->variables[record->variable];
+            unsigned int logicalAddress = variable->logicalMemory.logicalInitialByte + record->offset;
+            int logicalPage = addressPage(machine, logicalAddress); 
+            int physicalPage = addressPage(machine, record->physicalAddress);
+
+            int logicalByte = addressOffset(machine, logicalAddress); 
+            int physicalByte = addressOffset(machine, record->physicalAddress);
+
+            fprintf(output, "\n\t\t%s[%d] -> Endereço Lógico = %d : %d\n", variable->name, record->offset, logicalPage, logicalByte);
+            fprintf(output, "\t\t-> Endereço Físico = %d : %d\n", physicalPage, physicalByte);
+        }
+    }
+}//printTaskMemoryAccesses()
+
+/* Simula um acesso à memória de uma variável.
+   Esta função recebe a instrução decodificada para acessar a memória de uma variável específica da tarefa.
+   A variável é resolvida pelo índice do símbolo, em tempo constante. Se ela estiver declarada,
+   o acesso à memória é registrado, de forma compacta, no registro de acessos da tarefa. A tradução do endereço
+   consulta primeiro a TLB do núcleo e, em caso de falta, a tabela de páginas. Na paginação sob demanda,
+   o acesso a uma página não residente causa uma falta de página: a página é carregada e a tarefa é suspensa
+   pelo mesmo caminho da leitura de disco.
+   Parâmetros:
+   - instruction: Instrução decodificada de acesso à memória.
+   - taskDescriptor: Ponteiro para o descritor da tarefa (TaskDescriptor).
+   - scheduler: Ponteiro para o escalonador, cujo relógio marca o instante do acesso.
+   - roundRobin: Ponteiro para a estrutura RoundRobin contendo informações do sistema.
+   Retorno:
+   - TRUE se o acesso à memória foi realizado com sucesso; FALSE caso contrário.
+*/
+boolean memoryAccess(const ParsedInstruction* instruction, TaskDescriptor* taskDescriptor, Scheduler* scheduler, RoundRobin* roundRobin) {
+    unsigned int value = instruction->value;
+    int index = taskDescriptor->memory->symbolVariables[instruction->symbol];
+    if (index == UNDECLARED_VARIABLE) {
+        String identifier;
+        copyIdentifier(identifier, instruction);
+        fprintf(roundRobin->output, UNDECLARED_IDENTIFIER_ERROR, taskDescriptor->task->nameOfTask, identifier);
+        finishTask(taskDescriptor, TRUE, roundRobin);
+        return FALSE;
+    }
+
+    const Variable *variable = &taskDescriptor->memory->variables[index];
+    if (value >= variable->value) {
+        String identifier;
+        copyIdentifier(identifier, instruction);
+        fprintf(roundRobin->output, MEMORY_ACCESS_ERROR, taskDescriptor->task->nameOfTask, identifier, value);
+        finishTask(taskDescriptor, TRUE, roundRobin);
+        return FALSE;
+    }
+
+    FrameAllocator* allocator = &roundRobin->frameAllocator;
+    unsigned int logicalAddress = variable->logicalMemory.logicalInitialByte + value;
+    unsigned int page = addressPage(&roundRobin->machine, logicalAddress);
+    boolean pageFault = FALSE;
+    unsigned int frameNumber;
+    allocator->references++;
+    roundRobin->memoryAccesses++;
+    if (!lookupTlb(scheduler, roundRobin, taskDescriptor, page, &frameNumber)) {
+        pageFault = taskDescriptor->memory->pagination.frames[page] == NO_FRAME;
+        if (pageFault) {
+            handlePageFault(taskDescriptor, page, scheduler, roundRobin);
+        }
+        frameNumber = taskDescriptor->memory->pagination.frames[page];
+        insertTlbEntry(scheduler, roundRobin, taskDescriptor, page);
+    }
+    PhysicalFrame* frame = &allocator->frames[frameNumber];
+    frame->lastUse = allocator->references;
+    frame->referenced = TRUE;
+
+    TimeUnit timestamp = roundRobin->coreClock + roundRobin->preemptionTimeCounter - UT;
+    unsigned int physicalAddress = pageAddress(&roundRobin->machine, frameNumber) + addressOffset(&roundRobin->machine, logicalAddress);
+    if (!appendMemoryAccess(&taskDescriptor->memory->accessLog, index, value, physicalAddress, timestamp)) {
+        finishTask(taskDescriptor, TRUE, roundRobin);
+        return FALSE;
+    }
+    if (pageFault) {
+        readDisk(taskDescriptor, scheduler, roundRobin);
+    }
+    return TRUE;
+}//memoryAccess()
+
+/* Finaliza uma tarefa.
+   Esta função atualiza o status de uma tarefa para finalizada e configura a marca de abortada, se aplicável.
+   Atualiza também o tempo de término, libera o programa e os quadros físicos da tarefa e ajusta as métricas globais do sistema.
+   Parâmetros:
+   - taskDescriptor: Ponteiro para o descritor da tarefa (TaskDescriptor).
+   - aborted: Indica se a tarefa foi abortada (TRUE) ou concluída com sucesso (FALSE).
+   - roundRobin: Ponteiro para a estrutura RoundRobin contendo informações do sistema.
+*/
+void finishTask(TaskDescriptor* taskDescriptor, boolean aborted, RoundRobin* roundRobin) {
+    taskDescriptor->aborted = aborted;
+    changeTaskStatus(taskDescriptor, FINISHED, roundRobin);
+    if (aborted) {
+        roundRobin->abortedTasks++;
+    }
+    taskDescriptor->endTime = roundRobin->coreClock + roundRobin->preemptionTimeCounter - UT;
+    releaseTaskProgram(taskDescriptor->task);
+    free(taskDescriptor->memory->symbolVariables);
+    taskDescriptor->memory->symbolVariables = NULL;
+    releaseTaskFrames(taskDescriptor, &roundRobin->frameAllocator);
+    if (aborted) {
+        // Como o tempo de CPU, a espera de uma tarefa abortada não entra na média das tarefas executadas com sucesso.
+        roundRobin->totalCPUClocks -= taskDescriptor->cpuTime;
+        roundRobin->totalOutputTime -= taskDescriptor->inputOutputTime;
+        return;
+    }
+    // A espera é o tempo em que a tarefa esteve pronta: nem executando nem suspensa na leitura do disco.
+    long long waitTime = (long long) taskDescriptor->endTime - taskDescriptor->startTime - taskDescriptor->cpuTime - taskDescriptor->inputOutputTime;
+    if (waitTime > 0) {
+        roundRobin->waitTime += (TimeUnit) waitTime;
+    }
+}//finishTask()
+
+/* Aborta uma tarefa que não pôde ser colocada em uma estrutura do escalonador por falta de memória.
+   Parâmetros:
+   - taskDescriptor: Ponteiro para o descritor da tarefa.
+   - roundRobin: Ponteiro para a estrutura RoundRobin, com a saída das mensagens da simulação.
+*/
+void abortUnscheduledTask(TaskDescriptor* taskDescriptor, RoundRobin* roundRobin) {
+    fprintf(roundRobin->output, SCHEDULER_MEMORY_ERROR, taskDescriptor->task->nameOfTask);
+    finishTask(taskDescriptor, TRUE, roundRobin);
+}//abortUnscheduledTask()
+
+/* Verifica e atualiza as tarefas suspensas.
+   Esta função avança o relógio do escalonador pelo número de unidades de tempo especificado e retira da fila de
+   despertar apenas as tarefas cujo instante de despertar já foi alcançado, sem percorrer as demais tarefas.
+   As tarefas despertadas têm o status atualizado para READY e são devolvidas à política de escalonamento,
+   no núcleo em que executaram por último, na ordem do instante de despertar e, em caso de empate, na ordem de suspensão.
+   Parâmetros:
+   - scheduler: Ponteiro para o escalonador.
+   - roundRobin: Estrutura RoundRobin com a contagem de tarefas por estado.
+   - timeUnits: Unidades de tempo decorridas desde a última verificação.
+*/
+void checkAndUpdateSuspendedTasks(Scheduler* scheduler, RoundRobin* roundRobin, unsigned timeUnits) {
+    scheduler->clock += timeUnits;
+    TaskDescriptor* next = peekTaskDescriptor(scheduler->wakeUpQueue);
+    while (next != NULL && next->wakeUpTime <= scheduler->clock) {
+        popTaskDescriptor(scheduler->wakeUpQueue);
+        next->readyTime = next->wakeUpTime;
+        changeTaskStatus(next, READY, roundRobin);
+        Core* core = &scheduler->cores[next->core];
+        if (scheduler->policy->onWake(scheduler, core, next)) {
+            core->numberOfReadyTasks++;
+        }
+        else {
+            abortUnscheduledTask(next, roundRobin);
+        }
+        next = peekTaskDescriptor(scheduler->wakeUpQueue);
+    }
+}//checkAndUpdateSuspendedTasks()
+
+/* Desperta, em ordem de chegada, as tarefas que esperam por quadros livres.
+   Cada tarefa despertada é admitida na memória física com a reserva dos quadros que esperava; a fila para na
+   primeira tarefa que não cabe nos quadros restantes, para que uma espera longa não seja ultrapassada.
+   Parâmetros:
+   - scheduler: Ponteiro para o escalonador.
+   - roundRobin: Estrutura RoundRobin com o alocador de quadros e a contagem de tarefas por estado.
+*/
+void wakeMemoryWaiters(Scheduler* scheduler, RoundRobin* roundRobin) {
+    TaskDescriptorQueue* queue = scheduler->memoryWaitQueue;
+    FrameAllocator* allocator = &roundRobin->frameAllocator;
+    while (!isTaskDescriptorQueueEmpty(queue)
+        && queue->front->framesWanted <= allocator->numberOfFreeFrames - allocator->numberOfReservedFrames) {
+        TaskDescriptor* next = dequeueTaskDescriptor(queue);
+        reserveTaskFrames(next, allocator, next->framesWanted);
+        next->framesWanted = 0;
+        // Um núcleo atrasado não desperta a tarefa antes do instante em que outro núcleo a suspendeu.
+        next->readyTime = next->wakeUpTime > scheduler->clock ? next->wakeUpTime : scheduler->clock;
+        changeTaskStatus(next, READY, roundRobin);
+        Core* core = &scheduler->cores[next->core];
+        if (scheduler->policy->onWake(scheduler, core, next)) {
+            core->numberOfReadyTasks++;
+        }
+        else {
+            abortUnscheduledTask(next, roundRobin);
+        }
+    }
+}//wakeMemoryWaiters()
+
+/* Avança o relógio de um núcleo ocioso até um instante, contabilizando o intervalo como tempo ocioso.
+   Parâmetros:
+   - scheduler: Ponteiro para o escalonador.
+   - core: Núcleo ocioso.
+   - time: Instante, não anterior ao relógio do núcleo, até o qual o núcleo fica ocioso.
+   - roundRobin: Estrutura RoundRobin que acumula o tempo ocioso.
+*/
+void idleCoreUntil(Scheduler* scheduler, Core* core, TimeUnit time, RoundRobin* roundRobin) {
+    TimeUnit idleTime = time - core->clock;
+    core->clock = time;
+    roundRobin->idleTime += idleTime;
+    roundRobin->cores[core - scheduler->cores].idleTime += idleTime;
+}//idleCoreUntil()
+
+/* Avança o relógio do núcleo diretamente até o próximo evento quando não há tarefa pronta.
+   Em vez de simular a CPU ociosa uma unidade de tempo por vez, o relógio do núcleo salta para o menor instante
+   de despertar da fila de tarefas suspensas, para a chegada da próxima tarefa ou para o relógio de outro núcleo
+   mais adiantado (que pode devolver uma tarefa preemptada), e o intervalo saltado é contabilizado como tempo ocioso.
+   Parâmetros:
+   - scheduler: Ponteiro para o escalonador.
+   - core: Núcleo ocioso.
+   - roundRobin: Estrutura RoundRobin que acumula o tempo ocioso.
+   - numberOfTasks: Número total de tarefas, para saber se ainda há chegadas.
+   Retorno:
+   - TRUE se o relógio foi avançado, FALSE se não há evento futuro.
+*/
+boolean fastForwardIdleTime(Scheduler* scheduler, Core* core, RoundRobin* roundRobin, int numberOfTasks) {
+    boolean found = FALSE;
+    TimeUnit nextEvent = 0;
+    TaskDescriptor* next = peekTaskDescriptor(scheduler->wakeUpQueue);
+    if (next != NULL) {
+        nextEvent = next->wakeUpTime > core->clock ? next->wakeUpTime : core->clock;
+        found = TRUE;
+    }
+    TimeUnit arrival = (TimeUnit) scheduler->nextArrival;
+    if (scheduler->nextArrival < numberOfTasks && arrival > core->clock && (!found || arrival < nextEvent)) {
+        nextEvent = arrival;
+        found = TRUE;
+    }
+    for (unsigned int i = 0; i < scheduler->numberOfCores; i++) {
+        TimeUnit clock = scheduler->cores[i].clock;
+        if (clock > core->clock && (!found || clock < nextEvent)) {
+            nextEvent = clock;
+            found = TRUE;
+        }
+    }
+    if (!found) {
+        return FALSE;
+    }
+
+    idleCoreUntil(scheduler, core, nextEvent, roundRobin);
+    return TRUE;
+}//fastForwardIdleTime()
+
+/* Arredonda um número float para o inteiro mais próximo.
+   Esta função recebe um número em ponto flutuante e retorna o valor arredondado para o inteiro mais próximo.
+   Parâmetros:
+   - number: Número em ponto flutuante a ser arredondado.
+   Retorno:
+   - Valor arredondado para o inteiro mais próximo (int).
+*/
+int roundingNumber(float number) {
+    int integerPart = (int)number; 
+
+    if (number - integerPart > 0) {
+        return integerPart + 1; 
+    } 
+    else {
+        return integerPart; 
+    }
+}//roundingNumber()
+
+/* Atualiza a paginação de uma tarefa com base nos bytes alocados.
+   Esta função atualiza os valores de paginação de uma tarefa com base na quantidade de bytes alocados.
+   Parâmetros:
+   - taskDescriptor: Ponteiro para o descritor de tarefa (TaskDescriptor) a ser atualizado.
+   - bytes: Quantidade de bytes alocados.
+   - machine: Geometria de memória.
+*/
+void updatePagination(TaskDescriptor* taskDescriptor, unsigned int bytes, const MachineConfiguration* machine) {
+    taskDescriptor->memory->pagination.bytesAllocated = bytes;
+    taskDescriptor->memory->pagination.finalPage = roundingNumber((float) taskDescriptor->memory->pagination.bytesAllocated / machine->pageSize);
+    if (taskDescriptor->memory->pagination.finalPage > 0) {
+        taskDescriptor->memory->pagination.bytesAllocated = taskDescriptor->memory->pagination.finalPage * machine->pageSize - 1;
+    }
+}//updatePagination()
+
+/* Processa um cabeçalho de instrução para atualizar a paginação de uma tarefa.
+   Esta função processa o cabeçalho de uma instrução para atualizar os valores de paginação
+   de uma tarefa com base nos bytes especificados no cabeçalho, mapeando em quadros físicos as páginas do programa.
+   Sem quadros livres, a tarefa espera e o cabeçalho é repetido.
+   Parâmetros:
+   - instruction: Instrução decodificada do cabeçalho.
+   - taskDescriptor: Ponteiro para o descritor de tarefa (TaskDescriptor) a ser atualizado.
+   - scheduler: Ponteiro para o escalonador, com a fila de espera por memória.
+   - roundRobin: Ponteiro para a estrutura RoundRobin contendo informações do sistema.
+   Retorno:
+   - Retorna TRUE se a operação for bem-sucedida; FALSE, caso contrário.
+*/
+boolean header(const ParsedInstruction* instruction, TaskDescriptor* taskDescriptor, Scheduler* scheduler, RoundRobin* roundRobin) {
+    unsigned int bytes = instruction->value;
+
+    if (bytes > roundRobin->machine.logicalMemorySize) {
+        fprintf(roundRobin->output, ALLOCATION_SPACE_ERROR, taskDescriptor->task->nameOfTask, roundRobin->machine.logicalMemorySize);
+        finishTask(taskDescriptor, TRUE, roundRobin);
+        return FALSE;
+    }
+    if (bytes > 0 && !mapTaskPages(taskDescriptor, bytes - 1, scheduler, roundRobin)) {
+        return FALSE;
+    }
+    updatePagination(taskDescriptor, bytes, &roundRobin->machine);
+    
+    return TRUE;
+}//header()
+
+/* Lê uma sequência de dígitos decimais a partir da posição atual.
+   Parâmetros:
+   - cursor: Ponteiro para a posição atual da leitura, avançado até o primeiro byte que não é dígito.
+   - end: Fim dos bytes da instrução.
+   - value: Recebe o número lido, saturado em UINT_MAX.
+   Retorno:
+   - TRUE se pelo menos um dígito foi lido, FALSE caso contrário.
+*/
+boolean scanNumber(const char **cursor, const char *end, unsigned int *value) {
+    const char *start = *cursor;
+    unsigned long number = 0;
+
+    while (*cursor < end && **cursor >= '0' && **cursor <= '9') {
+        number = number * 10 + (**cursor - '0');
+        if (number > UINT_MAX) {
+            number = UINT_MAX;
+        }
+        (*cursor)++;
+    }
+    *value = (unsigned int) number;
+    return *cursor > start;
+}//scanNumber()
+
+/* Copia o identificador de uma instrução decodificada para uma String terminada em '\0'.
+   Parâmetros:
+   - destination: String que recebe o identificador.
+   - instruction: Instrução decodificada contendo o identificador.
+*/
+void copyIdentifier(String destination, const ParsedInstruction* instruction) {
+    unsigned int length = instruction->identifierLength;
+    if (length >= STRING_DEFAULT_SIZE) {
+        length = STRING_DEFAULT_SIZE - 1;
+    }
+    memcpy(destination, instruction->identifier, length);
+    destination[length] = NULL_CHAR;
+}//copyIdentifier()
+
+/* Determina o tipo de instrução e extrai seus operandos em uma única passagem.
+   Esta função é um analisador léxico escrito à mão que reconhece os padrões das instruções
+   (cabeçalho, new, acesso à memória e leitura de disco) sem compilar expressões regulares.
+   Parâmetros:
+   - instruction: Bytes da instrução a ser verificada (não precisa terminar com '\0').
+   - length: Quantidade de bytes da instrução.
+   - parsed: Estrutura que recebe o tipo e os operandos da instrução.
+   Retorno:
+   - Retorna um enum do tipo Instruction correspondente ao tipo de instrução encontrado,
+     ou INVALID_INSTRUCTION caso não corresponda a nenhum padrão conhecido.
+*/
+Instruction determineInstructionType(const char *instruction, size_t length, ParsedInstruction* parsed) {
+    const char *cursor = instruction;
+    const char *end = instruction + length;
+    Instruction type = INVALID_INSTRUCTION;
+
+    parsed->type = INVALID_INSTRUCTION;
+    parsed->identifier = NULL;
+    parsed->identifierLength = 0;
+    parsed->value = 0;
+
+    if (length == 0) {
+        return INVALID_INSTRUCTION;
+    }
+
+    if (*cursor == '#') {
+        // #T=<bytes>
+        size_t prefixLength = strlen(INSTRUCTION_HEADER_PREFIX);
+        if (length < prefixLength || memcmp(cursor, INSTRUCTION_HEADER_PREFIX, prefixLength) != 0) {
+            return INVALID_INSTRUCTION;
+        }
+        cursor += prefixLength;
+        if (!scanNumber(&cursor, end, &parsed->value)) {
+            return INVALID_INSTRUCTION;
+        }
+        type = HEADER;
+    }
+    else if (*cursor == '_' || (*cursor >= 'a' && *cursor <= 'z') || (*cursor >= 'A' && *cursor <= 'Z')) {
+        parsed->identifier = cursor;
+        while (cursor < end && (*cursor == '_' || (*cursor >= 'a' && *cursor <= 'z') ||
+               (*cursor >= 'A' && *cursor <= 'Z') || (*cursor >= '0' && *cursor <= '9'))) {
+            cursor++;
+        }
+        parsed->identifierLength = (unsigned int)(cursor - parsed->identifier);
+
+        const char *afterIdentifier = cursor;
+        while (cursor < end && isspace((unsigned char)*cursor)) {
+            cursor++;
+        }
+
+        size_t readDiskLength = strlen(INSTRUCTION_READ_DISK);
+        size_t keywordLength = strlen(INSTRUCTION_NEW_KEYWORD);
+        if (cursor < end && *cursor == '[') {
+            // <identificador>[<índice>]
+            cursor++;
+            if (!scanNumber(&cursor, end, &parsed->value) || cursor == end || *cursor != ']') {
+                return INVALID_INSTRUCTION;
+            }
+            cursor++;
+            type = MEMORY_ACCESS;
+        }
+        else if (cursor > afterIdentifier && (size_t)(end - cursor) > keywordLength &&
+                 memcmp(cursor, INSTRUCTION_NEW_KEYWORD, keywordLength) == 0 &&
+                 isspace((unsigned char)cursor[keywordLength])) {
+            // <identificador> new <bytes>
+            cursor += keywordLength;
+            while (cursor < end && isspace((unsigned char)*cursor)) {
+                cursor++;
+            }
+            if (!scanNumber(&cursor, end, &parsed->value)) {
+                return INVALID_INSTRUCTION;
+            }
+            type = NEW;
+        }
+        else if (length >= readDiskLength && memcmp(instruction, INSTRUCTION_READ_DISK, readDiskLength) == 0) {
+            // read disk
+            cursor = instruction + readDiskLength;
+            parsed->identifier = NULL;
+            parsed->identifierLength = 0;
+            type = READ_DISK;
+        }
+        else {
+            return INVALID_INSTRUCTION;
+        }
+    }
+    else {
+        return INVALID_INSTRUCTION;
+    }
+
+    // Apenas espaços em branco são permitidos até o fim da instrução.
+    while (cursor < end && isspace((unsigned char)*cursor)) {
+        cursor++;
+    }
+    if (cursor != end) {
+        return INVALID_INSTRUCTION;
+    }
+    parsed->type = type;
+    return type;
+}//determineInstructionType()
+
+/* Executa as instruções de uma tarefa dentro do quantum definido.
+   Esta função executa as instruções de uma tarefa dentro do quantum definido pela política de escalonamento.
+   Nas políticas não preemptivas, a tarefa executa até ser suspensa ou finalizada; em todas, a fatia termina assim que
+   a tarefa é suspensa ou finalizada. O contador de preempção excede em UT as unidades de tempo consumidas.
+   Parâmetros:
+   - scheduler: Ponteiro para o escalonador.
+   - roundRobin: Ponteiro para a estrutura RoundRobin contendo informações do sistema.
+   - taskDescriptor: Ponteiro para o descritor da tarefa em execução.
+   Retorno:
+   - Retorna o valor do contador de preempção após a execução das instruções.
+*/
+int executeInstruction(Scheduler* scheduler, RoundRobin* roundRobin, TaskDescriptor* taskDescriptor) {
+    // Sem tarefa pronta, a CPU fica ociosa por um quantum padrão.
+    TimeUnit quantum = scheduler->quantum;
+    if (taskDescriptor != NULL) {
+        quantum = scheduler->policy->quantum(scheduler, taskDescriptor);
+
+        // O programa da tarefa em execução fica residente e protegido do descarte durante toda a fatia.
+        if (acquireTaskProgram(taskDescriptor->task)) {
+            taskDescriptor->task->pool->pinned = taskDescriptor->task;
+        }
+        else {
+            fprintf(roundRobin->output, PROGRAM_RELOAD_ERROR, taskDescriptor->task->nameOfTask);
+            finishTask(taskDescriptor, TRUE, roundRobin);
+        }
+    }
+    boolean preemptive = quantum != NON_PREEMPTIVE_QUANTUM;
+
+    while (!preemptive || roundRobin->preemptionTimeCounter <= quantum) {
+        if (taskDescriptor != NULL && taskDescriptor->status == RUNNING) {
+            if (taskDescriptor->programCounter < taskDescriptor->numberOfInstructions) {
+                roundRobin->totalCPUClocks += UT;
+                taskDescriptor->cpuTime += UT;
+
+                ParsedInstruction parsed;
+                fetchInstruction(&taskDescriptor->task->program, taskDescriptor->programCounter++, &parsed);
+
+                switch (parsed.type) {
+                    case HEADER:
+                        // Decrementando os contatores, pois o header não deve ser processado no tempo final.
+                        // O contador de preempção só é decrementado depois: o header ocorre no instante do despacho.
+                        roundRobin->totalCPUClocks-= UT;
+                        taskDescriptor->cpuTime-= UT;
+                        header(&parsed, taskDescriptor, scheduler, roundRobin);
+                        roundRobin->preemptionTimeCounter--;
+                        break;
+                    case NEW:
+                        new(&parsed, taskDescriptor, scheduler, roundRobin);
+                        break;
+                    case MEMORY_ACCESS:
+                        memoryAccess(&parsed, taskDescriptor, scheduler, roundRobin);
+                        break;
+                    case READ_DISK:
+                        readDisk(taskDescriptor, scheduler, roundRobin);
+                        break;
+                    default:
+                        finishTask(taskDescriptor, FALSE, roundRobin);
+                        break;
+                }
+
+                if (taskDescriptor->framesWanted > 0) {
+                    // Sem quadros para admitir a tarefa: a instrução é repetida quando a tarefa despertar e a tentativa não consome tempo.
+                    taskDescriptor->programCounter--;
+                    if (parsed.type == HEADER) {
+                        roundRobin->preemptionTimeCounter += UT;
+                    }
+                    else {
+                        roundRobin->totalCPUClocks -= UT;
+                        taskDescriptor->cpuTime -= UT;
+                    }
+                    break;
+                }
+            } 
+            else {
+                finishTask(taskDescriptor, FALSE, roundRobin);
+                break;
+            }
+        }
+        else if (taskDescriptor != NULL) {
+            // A tarefa suspensa ou finalizada libera a CPU sem esperar o fim do quantum.
+            break;
+        }
+        else {
+            // Quantum sem tarefa em execução.
+            roundRobin->idleTime += UT;
+        }
+        roundRobin->preemptionTimeCounter += UT;
+    }
+    return roundRobin->preemptionTimeCounter;
+}//executeInstruction()
+
+/* Inicializa a estrutura RoundRobin com valores iniciais.
+   Esta função atribui valores iniciais aos campos da estrutura RoundRobin.
+   Parâmetros:
+   - roundRobin: Ponteiro para a estrutura RoundRobin a ser inicializada.
+*/
+void initializeRoundRobin(RoundRobin* roundRobin) {
+    roundRobin->totalCPUClocks = 0;
+    roundRobin->totalOutputTime = 0;
+    roundRobin->preemptionTimeCounter = 1;
+    roundRobin->policyName = NULL;
+    roundRobin->idleTime = 0;
+    roundRobin->elapsedTime = 0;
+    roundRobin->numberOfCores = DEFAULT_NUMBER_OF_CORES;
+    roundRobin->currentCore = 0;
+    roundRobin->migrations = 0;
+    roundRobin->output = stdout;
+    memset(roundRobin->cores, 0, sizeof(roundRobin->cores));
+    roundRobin->waitTime = 0;
+    roundRobin->abortedTasks = 0;
+    memset(roundRobin->tasksPerStatus, 0, sizeof(roundRobin->tasksPerStatus));
+    memset(&roundRobin->frameAllocator, 0, sizeof(FrameAllocator));
+    memset(&roundRobin->machine, 0, sizeof(MachineConfiguration));
+    roundRobin->memoryWaits = 0;
+    roundRobin->memoryAccesses = 0;
+    roundRobin->pageFaults = 0;
+    roundRobin->pageReplacements = 0;
+    memset(&roundRobin->tlb, 0, sizeof(TlbConfiguration));
+    roundRobin->tlbHits = 0;
+    roundRobin->tlbMisses = 0;
+    roundRobin->tlbFlushes = 0;
+    roundRobin->trace = NULL;
+    roundRobin->coreClock = 0;
+    roundRobin->checkpoint = NULL;
+}//initializeRoundRobin()
+
+/* Inicializa a fila de descritores de tarefa.
+   Esta função marca o instante de chegada das tarefas prontas e não abortadas, que a tarefa i recebe no instante i,
+   e faz a contagem inicial de tarefas por estado. As tarefas são admitidas na política por 'admitArrivedTasks()'
+   quando o relógio alcança a sua chegada.
+   Parâmetros:
+   - scheduler: Ponteiro para o escalonador cuja fila de tarefas prontas será inicializada.
+   - roundRobin: Estrutura RoundRobin que recebe a contagem de tarefas por estado.
+   - tasks: Array de descritores de tarefa.
+   - numberOfTasks: Número total de tarefas no array.
+*/
+void initializeTaskQueue(Scheduler* scheduler, RoundRobin* roundRobin, TaskDescriptor tasks[], int numberOfTasks) {
+    for (int i = 0; i < numberOfTasks; i++) {
+        roundRobin->tasksPerStatus[tasks[i].status]++;
+        if (tasks[i].aborted) {
+            roundRobin->abortedTasks++;
+        }
+        if (tasks[i].status == READY && tasks[i].aborted == FALSE) {
+            tasks[i].core = i % scheduler->numberOfCores;
+            tasks[i].startTime = i;
+            tasks[i].readyTime = i;
+            if (roundRobin->trace != NULL) {
+                roundRobin->trace->since[i] = i;
+            }
+        }
+    }
+    scheduler->nextArrival = 0;
+}//initializeTaskQueue()
+
+/* Admite na política de escalonamento as tarefas que chegaram até um instante.
+   As tarefas chegam em ordem, cada uma no instante igual ao seu índice, e entram na estrutura de prontos do seu núcleo;
+   uma tarefa que a política não consegue admitir é abortada. Assim, a política só escolhe tarefas que já chegaram.
+   Parâmetros:
+   - scheduler: Ponteiro para o escalonador.
+   - roundRobin: Estrutura RoundRobin com a contagem de tarefas por estado.
+   - tasks: Array de descritores de tarefa.
+   - numberOfTasks: Número total de tarefas no array.
+   - time: Instante até o qual as chegadas são admitidas.
+*/
+void admitArrivedTasks(Scheduler* scheduler, RoundRobin* roundRobin, TaskDescriptor tasks[], int numberOfTasks, TimeUnit time) {
+    while (scheduler->nextArrival < numberOfTasks && (TimeUnit) scheduler->nextArrival <= time) {
+        TaskDescriptor* taskDescriptor = &tasks[scheduler->nextArrival++];
+        if (taskDescriptor->status != READY || taskDescriptor->aborted) {
+            continue;
+        }
+        Core* core = &scheduler->cores[taskDescriptor->core];
+        if (scheduler->policy->onArrive(scheduler, core, taskDescriptor)) {
+            core->numberOfReadyTasks++;
+        }
+        else {
+            abortUnscheduledTask(taskDescriptor, roundRobin);
+        }
+    }
+}//admitArrivedTasks()
+
+/* Executa o escalonamento e execução das tarefas.
+   Esta função executa o escalonamento e a execução das tarefas enquanto houver tarefas a serem processadas.
+   A cada passo escalona o núcleo com o menor relógio local; um núcleo sem tarefas prontas rouba trabalho
+   do núcleo mais carregado e, se não houver trabalho, seu relógio avança diretamente até o próximo evento.
+   Uma tarefa nunca executa antes do instante em que ficou pronta: o núcleo fica ocioso até lá.
+   Parâmetros:
+   - scheduler: Ponteiro para o escalonador.
+   - roundRobin: Estrutura de informações do Round-Robin.
+   - tasks: Array de descritores de tarefa.
+   - numberOfTasks: Número total de tarefas no array.
+*/
+void runTasks(Scheduler* scheduler, RoundRobin* roundRobin, TaskDescriptor tasks[], int numberOfTasks) {
+    while (TRUE) {
+        // O loop so será finalizado quando todas as tarefas estiverem com estado igual a FINISH.
+        if (allTasksFinished(roundRobin, numberOfTasks)) {
+            break;
+        }
+        
+        // O núcleo mais atrasado escalona; o relógio global avança até ele, despertando as tarefas suspensas
+        // cujo tempo de suspensão terminou.
+        Core* core = nextCore(scheduler);
+
+        // O estado é salvo entre dois passos, antes que o núcleo escolhido altere qualquer estrutura.
+        Checkpoint* checkpoint = roundRobin->checkpoint;
+        if (checkpoint != NULL && (core->clock >= checkpoint->saveTime || (checkpoint->followsSignal && checkpointRequested))) {
+            // O instante pedido é salvo uma única vez; o sinal pode pedir novos estados até o fim da simulação.
+            if (core->clock >= checkpoint->saveTime) {
+                checkpoint->saveTime = NO_CHECKPOINT_TIME;
+            }
+            if (checkpoint->followsSignal) {
+                checkpointRequested = FALSE;
+            }
+            saveSnapshot(checkpoint, scheduler, roundRobin, tasks, numberOfTasks);
+        }
+        unsigned int coreIndex = core - scheduler->cores;
+        roundRobin->currentCore = coreIndex;
+        roundRobin->coreClock = core->clock;
+        INSTRUMENTATION_START(wakeUpStart);
+        checkAndUpdateSuspendedTasks(scheduler, roundRobin, core->clock - scheduler->clock);
+        INSTRUMENTATION_STOP(wakeUpStart, TIMER_SUSPENDED_TASKS);
+        admitArrivedTasks(scheduler, roundRobin, tasks, numberOfTasks, scheduler->clock);
+        wakeMemoryWaiters(scheduler, roundRobin);
+
+        // A política contém apenas tarefas com estados READY; um núcleo sem tarefas prontas rouba de outro núcleo.
+        TaskDescriptor* taskRunningPtr = pickReadyTask(scheduler, core);
+        if (taskRunningPtr == NULL && scheduler->numberOfCores > 1) {
+            taskRunningPtr = stealTask(scheduler, core, roundRobin);
+        }
+
+        // Sem tarefa pronta, o relógio do núcleo salta até o próximo evento. Uma tarefa que ficou pronta depois do
+        // relógio do núcleo, como a roubada de um núcleo mais adiantado, só executa a partir desse instante.
+        if (taskRunningPtr == NULL && fastForwardIdleTime(scheduler, core, roundRobin, numberOfTasks)) {
+            continue;
+        }
+        if (taskRunningPtr != NULL && taskRunningPtr->readyTime > core->clock) {
+            idleCoreUntil(scheduler, core, taskRunningPtr->readyTime, roundRobin);
+            roundRobin->coreClock = core->clock;
+        }
+        TimeUnit cpuTimeBefore = 0;
+        TimeUnit idleTimeBefore = roundRobin->idleTime;
+
+        // Alterando o estado para RUNNING, pois a tarefa será executada.
+        if (taskRunningPtr != NULL) {
+            changeTaskStatus(taskRunningPtr, RUNNING, roundRobin);
+            cpuTimeBefore = taskRunningPtr->cpuTime;
+            taskRunningPtr->core = coreIndex;
+            roundRobin->cores[coreIndex].dispatches++;
+            switchTlbContext(core, roundRobin, taskRunningPtr);
+        }
+        
+        // Executa a tarefa que foi retirada da fila.
+        INSTRUMENTATION_START(executionStart);
+        executeInstruction(scheduler, roundRobin, taskRunningPtr);
+        INSTRUMENTATION_STOP(executionStart, TIMER_EXECUTE_INSTRUCTION);
+        roundRobin->cores[coreIndex].idleTime += roundRobin->idleTime - idleTimeBefore;
+        
+        if (taskRunningPtr != NULL) {
+            TimeUnit ran = taskRunningPtr->cpuTime - cpuTimeBefore;
+            roundRobin->cores[coreIndex].busyTime += ran;
+
+            if (taskRunningPtr->status == RUNNING) {
+                // Caso a tarefa não sejá suspensa durante sua excecução, seu estado será mudada para READY e ela será devolvida à política.
+                changeTaskStatus(taskRunningPtr, READY, roundRobin);
+                taskRunningPtr->readyTime = core->clock + roundRobin->preemptionTimeCounter - UT;
+                // As tarefas que chegaram até o fim da fatia, em todos os núcleos, entram antes da tarefa preemptada.
+                TimeUnit arrivalTime = taskRunningPtr->readyTime;
+                for (unsigned int i = 0; i < scheduler->numberOfCores; i++) {
+                    if (&scheduler->cores[i] != core && scheduler->cores[i].clock < arrivalTime) {
+                        arrivalTime = scheduler->cores[i].clock;
+                    }
+                }
+                admitArrivedTasks(scheduler, roundRobin, tasks, numberOfTasks, arrivalTime);
+                if (scheduler->policy->onPreempt(scheduler, core, taskRunningPtr, ran)) {
+                    core->numberOfReadyTasks++;
+                }
+                else {
+                    abortUnscheduledTask(taskRunningPtr, roundRobin);
+                }
+            }
+            else if (taskRunningPtr->status == SUSPENDED) {
+                scheduler->policy->onBlock(scheduler, taskRunningPtr, ran);
+            }
+        }
+        
+        // Avançando o relógio local do núcleo pelas unidades de tempo consumidas na fatia.
+        core->clock += roundRobin->preemptionTimeCounter - UT;
+        
+        // Resetando o tempo de preempção.
+        roundRobin->preemptionTimeCounter = UT;
+    }
+
+    // O tempo decorrido é o do núcleo que terminou por último.
+    for (unsigned int i = 0; i < scheduler->numberOfCores; i++) {
+        if (scheduler->cores[i].clock > roundRobin->elapsedTime) {
+            roundRobin->elapsedTime = scheduler->cores[i].clock;
+        }
+    }
+}//runTasks()
+
+/* Agenda e executa as tarefas usando a política de escalonamento informada.
+   Esta função cria uma estrutura RoundRobin, o escalonador (estruturas de prontos da política e fila de despertar)
+   e coordena a execução das tarefas até que todas as tarefas tenham sido executadas.
+   Parâmetros:
+   - tasks: Array de descritores de tarefa.
+   - numberOfTasks: Número total de tarefas no array.
+   - policy: Política de escalonamento.
+   - replacement: Política de substituição de páginas, ou NULL para manter as páginas residentes.
+   - tlb: Configuração da TLB dos núcleos.
+   - machine: Geometria de memória e quantum, já configurados por 'configureMachine()'.
+   - numberOfCores: Número de núcleos simulados.
+   - trace: Registro de execução, ou NULL para não registrar as transições de estado.
+   - checkpoint: Estado salvo durante a simulação e estado restaurado no lugar da admissão das tarefas, ou NULL.
+     Se a restauração falhar, as tarefas não são executadas e 'checkpoint->restoreFailed' é marcado.
+   - output: Saída das mensagens da simulação.
+   Retorno:
+   - Estrutura RoundRobin com informações de execução das tarefas.
+*/
+RoundRobin scheduleTasks(TaskDescriptor tasks[], int numberOfTasks, const SchedulingPolicy* policy, const ReplacementPolicy* replacement, const TlbConfiguration* tlb, const MachineConfiguration* machine, unsigned int numberOfCores, EventTrace* trace, Checkpoint* checkpoint, FILE *output) {
+    RoundRobin roundRobin;
+    Scheduler scheduler;
+
+    initializeScheduler(&scheduler, policy, numberOfCores, tlb);
+    initializeRoundRobin(&roundRobin);
+    roundRobin.policyName = policy->displayName;
+    roundRobin.numberOfCores = numberOfCores;
+    roundRobin.output = output;
+    roundRobin.machine = *machine;
+    initializeFrameAllocator(&roundRobin.frameAllocator, machine);
+    roundRobin.frameAllocator.replacement = replacement;
+    roundRobin.tlb = *tlb;
+    roundRobin.trace = trace;
+    if (checkpoint != NULL && checkpoint->saveFileName != NULL) {
+        roundRobin.checkpoint = checkpoint;
+    }
+    scheduler.quantum = machine->quantum;
+    if (checkpoint != NULL && checkpoint->restoreFileName != NULL) {
+        checkpoint->restoreFailed = !restoreSnapshot(checkpoint, &scheduler, &roundRobin, tasks, numberOfTasks);
+    }
+    else {
+        initializeTaskQueue(&scheduler, &roundRobin, tasks, numberOfTasks);
+    }
+    if (checkpoint == NULL || !checkpoint->restoreFailed) {
+        runTasks(&scheduler, &roundRobin, tasks, numberOfTasks);
+    }
+    destroyFrameAllocator(&roundRobin.frameAllocator);
+    destroyScheduler(&scheduler);
+    return roundRobin;
+}//scheduleTasks()
+
+/* Valida o número de tarefas fornecidas ao programa.
+   Esta função verifica se pelo menos uma tarefa foi informada, seja por argumento, manifesto ou padrão glob.
+   Não há limite superior: a tabela de tarefas é alocada dinamicamente.
+   Parâmetros:
+   - numberOfTasks: O número de tarefas coletadas.
+   Retorno:
+   - TRUE se o número de tarefas for válido, FALSE caso contrário.
+*/
+boolean validateNumberOfArguments(int numberOfTasks) {
+    if (numberOfTasks < 1) {
+        return FALSE;
+    }
+    return TRUE;
+}//validateNumberOfArguments()
+
+/* Adiciona o nome de uma tarefa à lista de tarefas.
+   A extensão FILE_EXTENSION é removida, caso presente, pois ela é acrescentada na abertura do arquivo;
+   a extensão COMPILED_FILE_EXTENSION é mantida, pois indica um arquivo pré-compilado.
+   Parâmetros:
+   - taskList: Lista de tarefas.
+   - name: Nome (ou caminho) da tarefa.
+   - length: Quantidade de bytes do nome.
+   - priority: Prioridade estática da tarefa (menor valor = maior prioridade).
+   Retorno:
+   - TRUE se o nome foi adicionado, FALSE se não houve memória disponível.
+*/
+boolean addTaskName(TaskList* taskList, const char *name, size_t length, int priority) {
+    size_t extensionLength = strlen(FILE_EXTENSION);
+    if (length > extensionLength && memcmp(name + length - extensionLength, FILE_EXTENSION, extensionLength) == 0) {
+        length -= extensionLength;
+    }
+
+    if (taskList->numberOfTasks == taskList->capacity) {
+        int capacity = taskList->capacity == 0 ? INITIAL_TASK_LIST_CAPACITY : taskList->capacity * 2;
+        char **names = (char**)realloc(taskList->names, capacity * sizeof(char*));
+        if (names == NULL) {
+            return FALSE;
+        }
+        taskList->names = names;
+        int *priorities = (int*)realloc(taskList->priorities, capacity * sizeof(int));
+        if (priorities == NULL) {
+            return FALSE;
+        }
+        taskList->priorities = priorities;
+        taskList->capacity = capacity;
+    }
+
+    char *copy = (char*)malloc(length + 1);
+    if (copy == NULL) {
+        return FALSE;
+    }
+    memcpy(copy, name, length);
+    copy[length] = NULL_CHAR;
+    taskList->names[taskList->numberOfTasks] = copy;
+    taskList->priorities[taskList->numberOfTasks++] = priority;
+    return TRUE;
+}//addTaskName()
+
+/* Lê a prioridade estática de uma tarefa no manifesto: um número inteiro, com sinal opcional, sem outros caracteres.
+   Parâmetros:
+   - text: Texto da prioridade, possivelmente precedido de espaços.
+   - priority: Recebe a prioridade lida.
+   Retorno:
+   - TRUE se o texto é um número inteiro válido, FALSE caso contrário.
+*/
+boolean parseTaskPriority(const char *text, int *priority) {
+    while (isspace((unsigned char)*text)) {
+        text++;
+    }
+    const char *digits = (*text == '-' || *text == '+') ? text + 1 : text;
+    if (!isdigit((unsigned char)*digits)) {
+        return FALSE;
+    }
+    char *end;
+    errno = 0;
+    long number = strtol(text, &end, 10);
+    if (errno == ERANGE || *end != NULL_CHAR || number < INT_MIN || number > INT_MAX) {
+        return FALSE;
+    }
+    *priority = (int) number;
+    return TRUE;
+}//parseTaskPriority()
+
+/* Adiciona à lista as tarefas listadas em um arquivo de manifesto.
+   O manifesto contém um nome de tarefa por linha, opcionalmente seguido da sua prioridade estática;
+   linhas vazias e iniciadas por '#' são ignoradas, e uma prioridade inválida é informada com a sua linha.
+   Parâmetros:
+   - taskList: Lista de tarefas.
+   - manifestName: Caminho do arquivo de manifesto.
+   - output: Saída das mensagens de erro.
+   Retorno:
+   - TRUE se o manifesto foi lido, FALSE caso contrário.
+*/
+boolean loadTaskManifest(TaskList* taskList, const char *manifestName, FILE *output) {
+    FILE *manifest = fopen(manifestName, "r");
+    if (manifest == NULL) {
+        fprintf(output, MANIFEST_OPEN_ERROR, manifestName);
+        return FALSE;
+    }
+
+    char *line = NULL;
+    size_t lineCapacity = 0;
+    ssize_t length;
+    boolean loaded = TRUE;
+
+    while (loaded && (length = getline(&line, &lineCapacity, manifest)) != -1) {
+        char *start = line;
+        char *end = line + length;
+        while (start < end && isspace((unsigned char)*start)) {
+            start++;
+        }
+        while (end > start && isspace((unsigned char)end[-1])) {
+            end--;
+        }
+        *end = NULL_CHAR;
+        if (start == end || *start == '#') {
+            continue;
+        }
+
+        // Prioridade opcional após o nome da tarefa.
+        const char *nameEnd = start;
+        while (nameEnd < end && !isspace((unsigned char)*nameEnd)) {
+            nameEnd++;
+        }
+        int priority = 0;
+        if (nameEnd < end && !parseTaskPriority(nameEnd, &priority)) {
+            fprintf(output, MANIFEST_LINE_ERROR, manifestName, start);
+            loaded = FALSE;
+        }
+        else {
+            loaded = addTaskName(taskList, start, nameEnd - start, priority);
+        }
+    }
+    free(line);
+    fclose(manifest);
+    return loaded;
+}//loadTaskManifest()
+
+/* Adiciona à lista as tarefas cujos arquivos correspondem a um padrão glob (ex.: "tarefas/t[0-9]*.tsk").
+   Parâmetros:
+   - taskList: Lista de tarefas.
+   - pattern: Padrão glob dos arquivos de tarefa.
+   Retorno:
+   - TRUE se o padrão foi expandido, FALSE em caso de erro de memória.
+*/
+boolean loadTaskGlob(TaskList* taskList, const char *pattern) {
+    glob_t globResult;
+    int result = glob(pattern, 0, NULL, &globResult);
+
+    if (result == GLOB_NOMATCH) {
+        return TRUE;
+    }
+    if (result != 0) {
+        return FALSE;
+    }
+
+    boolean loaded = TRUE;
+    for (size_t i = 0; loaded && i < globResult.gl_pathc; i++) {
+        loaded = addTaskName(taskList, globResult.gl_pathv[i], strlen(globResult.gl_pathv[i]), 0);
+    }
+    globfree(&globResult);
+    return loaded;
+}//loadTaskGlob()
+
+/* Libera a memória da lista de tarefas.
+   Parâmetros:
+   - taskList: Lista de tarefas a ser liberada.
+*/
+void freeTaskList(TaskList* taskList) {
+    for (int i = 0; i < taskList->numberOfTasks; i++) {
+        free(taskList->names[i]);
+    }
+    free(taskList->names);
+    free(taskList->priorities);
+    memset(taskList, 0, sizeof(TaskList));
+}//freeTaskList()
+
+/* Aloca a tabela de tarefas de uma simulação, com os vetores de descritores, de nomes e programas
+   e de dados de memória.
+   Parâmetros:
+   - table: Tabela a ser alocada.
+   - numberOfTasks: Número de tarefas.
+   Retorno:
+   - TRUE se a tabela foi alocada, FALSE se não houve memória disponível.
+*/
+boolean createTaskTable(TaskTable* table, int numberOfTasks) {
+    table->descriptors = (TaskDescriptor*)calloc(numberOfTasks, sizeof(TaskDescriptor));
+    table->tasks = (Task*)calloc(numberOfTasks, sizeof(Task));
+    table->memories = (TaskMemory*)calloc(numberOfTasks, sizeof(TaskMemory));
+    table->numberOfTasks = numberOfTasks;
+    if (table->descriptors == NULL || table->tasks == NULL || table->memories == NULL) {
+        free(table->descriptors);
+        free(table->tasks);
+        free(table->memories);
+        return FALSE;
+    }
+    return TRUE;
+}//createTaskTable()
+
+/* Inicializa um descritor de tarefa.
+   Esta função inicializa um descritor de tarefa com valores padrão e um programa vazio.
+   O nome exibido nos relatórios não inclui a extensão COMPILED_FILE_EXTENSION, que continua no nome do arquivo;
+   assim, a mesma tarefa tem o mesmo nome carregada do código-fonte ou pré-compilada.
+   Parâmetros:
+   - descriptor: O descritor de tarefa a ser inicializado.
+   - task: Nome e programa da tarefa, na tabela de tarefas.
+   - memory: Dados de memória da tarefa, na tabela de tarefas.
+   - taskName: O nome da tarefa para identificação.
+*/
+void initializeTaskDescriptor(TaskDescriptor* descriptor, Task* task, TaskMemory* memory, const char *taskName) {
+    // Inicializa todos os atributos com 0
+    memset(descriptor, 0, sizeof(TaskDescriptor));
+    memset(task, 0, sizeof(Task));
+    memset(memory, 0, sizeof(TaskMemory));
+    descriptor->task = task;
+    descriptor->memory = memory;
+
+    size_t length = strlen(taskName);
+    size_t compiledExtensionLength = strlen(COMPILED_FILE_EXTENSION);
+    if (length > compiledExtensionLength && strcmp(taskName + length - compiledExtensionLength, COMPILED_FILE_EXTENSION) == 0) {
+        length -= compiledExtensionLength;
+    }
+    snprintf(descriptor->task->nameOfTask, STRING_DEFAULT_SIZE, "%.*s", (int) length, taskName);
+    descriptor->task->fileName = taskName;
+    descriptor->status = READY;
+    descriptor->aborted = FALSE;
+}//initializeTaskDescriptor()
+
+/* Prepara a resolução das variáveis de uma tarefa cujo programa já foi carregado.
+   Cria o mapa de símbolo para variável, com uma posição por símbolo do programa, marcando todos como não declarados.
+   Parâmetros:
+   - descriptor: Descritor da tarefa.
+   Retorno:
+   - TRUE se o mapa foi criado, FALSE se não houve memória disponível.
+*/
+boolean initializeTaskVariables(TaskDescriptor* descriptor) {
+    unsigned int numberOfSymbols = descriptor->task->program.numberOfSymbols;
+    descriptor->memory->symbolVariables = (int*)malloc((numberOfSymbols > 0 ? numberOfSymbols : 1) * sizeof(int));
+    if (descriptor->memory->symbolVariables == NULL) {
+        return FALSE;
+    }
+    for (unsigned int i = 0; i < numberOfSymbols; i++) {
+        descriptor->memory->symbolVariables[i] = UNDECLARED_VARIABLE;
+    }
+    return TRUE;
+}//initializeTaskVariables()
+
+/* Libera as variáveis e o mapa de símbolos de uma tarefa.
+   Parâmetros:
+   - descriptor: Descritor da tarefa.
+*/
+void freeTaskVariables(TaskDescriptor* descriptor) {
+    free(descriptor->memory->variables);
+    free(descriptor->memory->symbolVariables);
+    descriptor->memory->variables = NULL;
+    descriptor->memory->symbolVariables = NULL;
+    descriptor->memory->quantityVariables = 0;
+    descriptor->memory->variablesCapacity = 0;
+}//freeTaskVariables()
+
+/* Libera a tabela de tarefas, com os programas, as variáveis, os registros de acesso e as tabelas de páginas.
+   Parâmetros:
+   - table: Tabela a ser liberada.
+*/
+void freeTaskTable(TaskTable* table) {
+    for (int i = 0; i < table->numberOfTasks; i++) {
+        freeTaskProgram(&table->tasks[i].program);
+        freeTaskVariables(&table->descriptors[i]);
+        freeMemoryAccessLog(&table->memories[i].accessLog);
+        free(table->memories[i].pagination.frames);
+    }
+    free(table->descriptors);
+    free(table->tasks);
+    free(table->memories);
+    memset(table, 0, sizeof(TaskTable));
+}//freeTaskTable()
+
+/* Calcula o hash FNV-1a de um identificador.
+   Parâmetros:
+   - identifier: Bytes do identificador.
+   - length: Quantidade de bytes.
+   Retorno:
+   - Hash de 32 bits do identificador.
+*/
+unsigned int hashIdentifier(const char *identifier, unsigned int length) {
+    unsigned int hash = FNV_OFFSET_BASIS;
+    for (unsigned int i = 0; i < length; i++) {
+        hash ^= (unsigned char) identifier[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}//hashIdentifier()
+
+/* Dobra a tabela hash de símbolos do programa e reinsere os símbolos.
+   Parâmetros:
+   - program: Programa da tarefa.
+   Retorno:
+   - TRUE se a tabela foi ampliada, FALSE se não houve memória disponível.
+*/
+boolean growSymbolBuckets(TaskProgram* program) {
+    unsigned int numberOfBuckets = program->numberOfBuckets == 0 ? INITIAL_SYMBOL_TABLE_CAPACITY : program->numberOfBuckets * 2;
+    unsigned int *buckets = (unsigned int*)calloc(numberOfBuckets, sizeof(unsigned int));
+    if (buckets == NULL) {
+        return FALSE;
+    }
+
+    unsigned int mask = numberOfBuckets - 1;
+    for (unsigned int i = 0; i < program->numberOfSymbols; i++) {
+        unsigned int bucket = program->symbols[i].hash & mask;
+        while (buckets[bucket] != 0) {
+            bucket = (bucket + 1) & mask;
+        }
+        buckets[bucket] = i + 1;
+    }
+    free(program->symbolBuckets);
+    program->symbolBuckets = buckets;
+    program->numberOfBuckets = numberOfBuckets;
+    return TRUE;
+}//growSymbolBuckets()
+
+/* Interna um identificador na tabela de símbolos do programa.
+   O identificador é procurado pelo seu hash; se ainda não existir, seus bytes são copiados uma única vez
+   para o vetor de identificadores e um novo símbolo é criado. O custo não depende do número de símbolos.
+   Parâmetros:
+   - program: Programa da tarefa.
+   - identifier: Bytes do identificador.
+   - length: Quantidade de bytes.
+   - symbol: Recebe o índice do símbolo.
+   Retorno:
+   - TRUE se o identificador foi internado, FALSE se não houve memória disponível.
+*/
+boolean internSymbol(TaskProgram* program, const char *identifier, unsigned int length, unsigned int *symbol) {
+    // Mantém a ocupação da tabela em no máximo metade das posições.
+    if ((program->numberOfSymbols + 1) * 2 > program->numberOfBuckets && !growSymbolBuckets(program)) {
+        return FALSE;
+    }
+
+    unsigned int hash = hashIdentifier(identifier, length);
+    unsigned int mask = program->numberOfBuckets - 1;
+    unsigned int bucket = hash & mask;
+    while (program->symbolBuckets[bucket] != 0) {
+        const Symbol *candidate = &program->symbols[program->symbolBuckets[bucket] - 1];
+        if (candidate->hash == hash && candidate->identifierLength == length
+            && memcmp(program->identifiers + candidate->identifierOffset, identifier, length) == 0) {
+            *symbol = program->symbolBuckets[bucket] - 1;
+            return TRUE;
+        }
+        bucket = (bucket + 1) & mask;
+    }
+
+    if (program->numberOfSymbols == program->symbolsCapacity) {
+        unsigned int capacity = program->symbolsCapacity == 0 ? INITIAL_PROGRAM_CAPACITY : program->symbolsCapacity * 2;
+        Symbol *symbols = (Symbol*)realloc(program->symbols, capacity * sizeof(Symbol));
+        if (symbols == NULL) {
+            return FALSE;
+        }
+        program->symbols = symbols;
+        program->symbolsCapacity = capacity;
+    }
+
+    if (program->identifiersSize + length > program->identifiersCapacity) {
+        unsigned int capacity = program->identifiersCapacity == 0 ? INITIAL_PROGRAM_CAPACITY : program->identifiersCapacity;
+        while (program->identifiersSize + length > capacity) {
+            capacity *= 2;
+        }
+        char* identifiers = (char*)realloc(program->identifiers, capacity);
+        if (identifiers == NULL) {
+            return FALSE;
+        }
+        program->identifiers = identifiers;
+        program->identifiersCapacity = capacity;
+    }
+
+    Symbol *created = &program->symbols[program->numberOfSymbols];
+    created->identifierOffset = program->identifiersSize;
+    created->identifierLength = length;
+    created->hash = hash;
+    memcpy(program->identifiers + program->identifiersSize, identifier, length);
+    program->identifiersSize += length;
+    program->symbolBuckets[bucket] = program->numberOfSymbols + 1;
+    *symbol = program->numberOfSymbols++;
+    return TRUE;
+}//internSymbol()
+
+/* Adiciona uma instrução decodificada ao programa da tarefa.
+   O identificador da instrução é internado na tabela de símbolos do programa e a instrução guarda
+   apenas o índice do símbolo.
+   Parâmetros:
+   - program: Programa da tarefa.
+   - parsed: Instrução decodificada pelo analisador léxico.
+   Retorno:
+   - TRUE se a instrução foi adicionada, FALSE se não houve memória disponível.
+*/
+boolean appendInstruction(TaskProgram* program, const ParsedInstruction* parsed) {
+    if (program->numberOfInstructions == program->instructionsCapacity) {
+        unsigned int capacity = program->instructionsCapacity == 0 ? INITIAL_PROGRAM_CAPACITY : program->instructionsCapacity * 2;
+        ProgramInstruction* instructions = (ProgramInstruction*)realloc(program->instructions, capacity * sizeof(ProgramInstruction));
+        if (instructions == NULL) {
+            return FALSE;
+        }
+        program->instructions = instructions;
+        program->instructionsCapacity = capacity;
+    }
+
+    unsigned int symbol = NO_SYMBOL;
+    if (parsed->identifierLength > 0 && !internSymbol(program, parsed->identifier, parsed->identifierLength, &symbol)) {
+        return FALSE;
+    }
+
+    ProgramInstruction* instruction = &program->instructions[program->numberOfInstructions++];
+    instruction->type = parsed->type;
+    instruction->value = parsed->value;
+    instruction->symbol = symbol;
+    return TRUE;
+}//appendInstruction()
+
+/* Recupera uma instrução do programa da tarefa.
+   Parâmetros:
+   - program: Programa da tarefa.
+   - index: Índice da instrução no programa.
+   - instruction: Estrutura que recebe a instrução, com o identificador apontando para o programa.
+*/
+void fetchInstruction(const TaskProgram* program, unsigned int index, ParsedInstruction* instruction) {
+    const ProgramInstruction* stored = &program->instructions[index];
+    instruction->type = stored->type;
+    instruction->value = stored->value;
+    instruction->symbol = stored->symbol;
+    if (stored->symbol != NO_SYMBOL) {
+        const Symbol *symbol = &program->symbols[stored->symbol];
+        instruction->identifier = program->identifiers + symbol->identifierOffset;
+        instruction->identifierLength = symbol->identifierLength;
+    }
+    else {
+        instruction->identifier = NULL;
+        instruction->identifierLength = 0;
+    }
+}//fetchInstruction()
+
+/* Libera a memória do programa da tarefa, inclusive a imagem do arquivo compilado.
+   Parâmetros:
+   - program: Programa da tarefa a ser liberado.
+*/
+void freeTaskProgram(TaskProgram* program) {
+    if (program->image != NULL) {
+        if (program->imageMapped) {
+            munmap(program->image, program->imageSize);
+        }
+        else {
+            free(program->image);
+        }
+    }
+    else {
+        free(program->instructions);
+        free(program->identifiers);
+        free(program->symbols);
+    }
+    free(program->symbolBuckets);
+    memset(program, 0, sizeof(TaskProgram));
+}//freeTaskProgram()
+
+/* Inicializa um conjunto de programas residentes vazio.
+   Parâmetros:
+   - pool: Conjunto a ser inicializado.
+   - capacity: Limite de programas residentes, ou 0 para nunca descartar.
+   - output: Saída das mensagens de erro das recargas.
+*/
+void initializeProgramPool(ProgramPool* pool, unsigned int capacity, FILE *output) {
+    memset(pool, 0, sizeof(ProgramPool));
+    pool->capacity = capacity;
+    pool->output = output;
+}//initializeProgramPool()
+
+/* Insere uma tarefa com programa carregado no início (mais recente) da lista LRU do conjunto.
+   Parâmetros:
+   - pool: Conjunto de programas residentes.
+   - task: Tarefa cujo programa acabou de ser carregado.
+*/
+void linkResidentProgram(ProgramPool* pool, Task* task) {
+    task->resident = TRUE;
+    task->moreRecent = NULL;
+    task->lessRecent = pool->mostRecent;
+    if (pool->mostRecent != NULL) {
+        pool->mostRecent->moreRecent = task;
+    }
+    else {
+        pool->leastRecent = task;
+    }
+    pool->mostRecent = task;
+    pool->residentPrograms++;
+}//linkResidentProgram()
+
+/* Retira uma tarefa da lista LRU do conjunto, sem liberar o programa.
+   Parâmetros:
+   - pool: Conjunto de programas residentes.
+   - task: Tarefa com programa residente.
+*/
+void unlinkResidentProgram(ProgramPool* pool, Task* task) {
+    if (task->moreRecent != NULL) {
+        task->moreRecent->lessRecent = task->lessRecent;
+    }
+    else {
+        pool->mostRecent = task->lessRecent;
+    }
+    if (task->lessRecent != NULL) {
+        task->lessRecent->moreRecent = task->moreRecent;
+    }
+    else {
+        pool->leastRecent = task->moreRecent;
+    }
+    task->moreRecent = NULL;
+    task->lessRecent = NULL;
+    task->resident = FALSE;
+    pool->residentPrograms--;
+}//unlinkResidentProgram()
+
+/* Descarta os programas menos usados recentemente até o conjunto respeitar o seu limite e atualiza o pico de programas residentes.
+   O programa da tarefa em execução e o da tarefa mais recente nunca são descartados; por isso o limite pode ser
+   excedido temporariamente em um programa.
+   Parâmetros:
+   - pool: Conjunto de programas residentes.
+*/
+void evictResidentPrograms(ProgramPool* pool) {
+    Task *candidate = pool->leastRecent;
+    while (pool->capacity > 0 && pool->residentPrograms > pool->capacity && candidate != NULL && candidate != pool->mostRecent) {
+        Task *next = candidate->moreRecent;
+        if (candidate != pool->pinned) {
+            unlinkResidentProgram(pool, candidate);
+            freeTaskProgram(&candidate->program);
+        }
+        candidate = next;
+    }
+    if (pool->residentPrograms > pool->peakResidentPrograms) {
+        pool->peakResidentPrograms = pool->residentPrograms;
+    }
+}//evictResidentPrograms()
+
+/* Registra no conjunto o programa de uma tarefa recém-validada.
+   As primeiras tarefas, que executam primeiro, ficam residentes até o limite; as demais têm o programa descartado
+   logo após a validação e o recarregam no primeiro despacho.
+   Parâmetros:
+   - pool: Conjunto de programas residentes.
+   - task: Tarefa com o programa validado.
+*/
+void admitTaskProgram(ProgramPool* pool, Task* task) {
+    task->pool = pool;
+    task->numberOfInstructions = task->program.numberOfInstructions;
+    task->numberOfSymbols = task->program.numberOfSymbols;
+    if (pool->capacity > 0 && pool->residentPrograms >= pool->capacity) {
+        freeTaskProgram(&task->program);
+        return;
+    }
+    linkResidentProgram(pool, task);
+    evictResidentPrograms(pool);
+}//admitTaskProgram()
+
+/* Garante que o programa de uma tarefa esteja residente, recarregando-o do arquivo se foi descartado, e o marca
+   como o usado mais recentemente. A tarefa continua do seu contador de programa, pois o programa recarregado é conferido
+   com as contagens do programa validado.
+   Parâmetros:
+   - task: Tarefa cujo programa será usado.
+   Retorno:
+   - TRUE se o programa está residente, FALSE se o arquivo não pôde ser reaberto ou mudou desde a validação.
+*/
+boolean acquireTaskProgram(Task* task) {
+    ProgramPool *pool = task->pool;
+    if (task->resident) {
+        if (pool->mostRecent != task) {
+            unlinkResidentProgram(pool, task);
+            linkResidentProgram(pool, task);
+        }
+        return TRUE;
+    }
+
+    INSTRUMENTATION_START(validationStart);
+    boolean valid = validateFile(task->fileName, &task->program, pool->output);
+    INSTRUMENTATION_STOP(validationStart, TIMER_VALIDATE_FILE);
+    if (!valid) {
+        return FALSE;
+    }
+    if (task->program.numberOfInstructions != task->numberOfInstructions || task->program.numberOfSymbols != task->numberOfSymbols) {
+        freeTaskProgram(&task->program);
+        return FALSE;
+    }
+    pool->reloads++;
+    linkResidentProgram(pool, task);
+    evictResidentPrograms(pool);
+    return TRUE;
+}//acquireTaskProgram()
+
+/* Libera o programa de uma tarefa finalizada, retirando-o do conjunto de programas residentes.
+   Parâmetros:
+   - task: Tarefa finalizada.
+*/
+void releaseTaskProgram(Task* task) {
+    ProgramPool *pool = task->pool;
+    if (pool != NULL) {
+        if (task->resident) {
+            unlinkResidentProgram(pool, task);
+        }
+        if (pool->pinned == task) {
+            pool->pinned = NULL;
+        }
+    }
+    freeTaskProgram(&task->program);
+}//releaseTaskProgram()
+
+/* Decodifica o conteúdo de um arquivo de tarefa diretamente dos seus bytes.
+   As linhas são delimitadas por '\n' e não possuem limite de tamanho. A primeira instrução deve ser o
+   cabeçalho e as demais devem ser dos tipos 1, 2 e 3.
+   Parâmetros:
+   - data: Bytes do arquivo (mapeados em memória ou lidos do descritor).
+   - size: Quantidade de bytes.
+   - program: Programa que recebe as instruções decodificadas.
+   Retorno:
+   - TRUE se todas as instruções são válidas, FALSE caso contrário.
+*/
+boolean parseTaskProgram(const char *data, size_t size, TaskProgram* program) {
+    const char *line = data;
+    const char *end = data + size;
+    ParsedInstruction parsed;
+
+    while (line < end) {
+        const char *newLine = memchr(line, '\n', end - line);
+        const char *lineEnd = newLine != NULL ? newLine : end;
+
+        INSTRUMENTATION_START(decodingStart);
+        Instruction instructionType = determineInstructionType(line, lineEnd - line, &parsed);
+        INSTRUMENTATION_STOP(decodingStart, TIMER_DETERMINE_INSTRUCTION);
+        boolean valid;
+        if (program->numberOfInstructions == 0) {
+            valid = instructionType == HEADER;
+        }
+        else {
+            valid = instructionType == NEW || instructionType == MEMORY_ACCESS || instructionType == READ_DISK;
+        }
+        if (!valid || !appendInstruction(program, &parsed)) {
+            return FALSE;
+        }
+        line = lineEnd + 1;
+    }
+    return TRUE;
+}//parseTaskProgram()
+
+/* Lê todo o conteúdo de um descritor de arquivo que não pode ser mapeado em memória.
+   Parâmetros:
+   - fileDescriptor: Descritor de arquivo aberto para leitura.
+   - size: Recebe a quantidade de bytes lidos.
+   Retorno:
+   - Buffer alocado com o conteúdo lido (deve ser liberado com free), ou NULL em caso de erro.
+*/
+char* readTaskFileBuffered(int fileDescriptor, size_t* size) {
+    size_t capacity = BUFFERED_READ_SIZE;
+    char *buffer = (char*)malloc(capacity);
+    *size = 0;
+
+    while (buffer != NULL) {
+        if (*size == capacity) {
+            capacity *= 2;
+            char *grown = (char*)realloc(buffer, capacity);
+            if (grown == NULL) {
+                free(buffer);
+                return NULL;
+            }
+            buffer = grown;
+        }
+        ssize_t bytesRead = read(fileDescriptor, buffer + *size, capacity - *size);
+        if (bytesRead < 0) {
+            free(buffer);
+            return NULL;
+        }
+        if (bytesRead == 0) {
+            break;
+        }
+        *size += bytesRead;
+    }
+    return buffer;
+}//readTaskFileBuffered()
+
+/* Carrega um arquivo de tarefa pré-compilado (.tskb).
+   Arquivos a partir de COMPILED_MAPPING_THRESHOLD bytes são mapeados em memória, e os menores são lidos para um único
+   bloco; o programa aponta diretamente para as instruções, os símbolos e os identificadores da imagem, sem decodificar
+   texto. Apenas a estrutura é verificada: o tamanho das seções, o tipo de cada instrução e os índices de símbolos,
+   de forma que um arquivo corrompido não leva a acessos fora da imagem.
+   Parâmetros:
+   - fileName: Caminho do arquivo compilado, com a extensão.
+   - program: Programa que recebe as instruções; a imagem é liberada por 'freeTaskProgram()'.
+   - output: Saída das mensagens de erro.
+   Retorno:
+   - TRUE se o arquivo é válido, FALSE caso contrário.
+*/
+boolean loadCompiledTask(const char *fileName, TaskProgram* program, FILE *output) {
+    int fileDescriptor = open(fileName, O_RDONLY);
+    struct stat fileStatus;
+    if (fileDescriptor < 0 || fstat(fileDescriptor, &fileStatus) != 0) {
+        if (fileDescriptor >= 0) {
+            close(fileDescriptor);
+        }
+        fprintf(output, FILE_OPEN_ERROR, fileName);
+        return FALSE;
+    }
+    void *image = NULL;
+    boolean mapped = S_ISREG(fileStatus.st_mode) && fileStatus.st_size >= COMPILED_MAPPING_THRESHOLD;
+    if (mapped) {
+        image = mmap(NULL, fileStatus.st_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        if (image == MAP_FAILED) {
+            image = NULL;
+        }
+    }
+    else if (S_ISREG(fileStatus.st_mode) && (size_t) fileStatus.st_size >= sizeof(CompiledTaskHeader)) {
+        image = malloc(fileStatus.st_size);
+        if (image != NULL && read(fileDescriptor, image, fileStatus.st_size) != fileStatus.st_size) {
+            free(image);
+            image = NULL;
+        }
+    }
+    close(fileDescriptor);
+    if (image == NULL) {
+        fprintf(output, COMPILED_FILE_ERROR, fileName);
+        return FALSE;
+    }
+
+    const CompiledTaskHeader* header = (const CompiledTaskHeader*) image;
+    unsigned long long expectedSize = sizeof(CompiledTaskHeader) + (unsigned long long) header->numberOfInstructions * sizeof(ProgramInstruction)
+        + (unsigned long long) header->numberOfSymbols * sizeof(Symbol) + header->identifiersSize;
+    boolean valid = memcmp(header->magic, COMPILED_FILE_MAGIC, sizeof(header->magic)) == 0 && header->version == COMPILED_FILE_VERSION
+        && header->byteOrder == COMPILED_FILE_BYTE_ORDER && expectedSize == (unsigned long long) fileStatus.st_size;
+
+    program->image = image;
+    program->imageSize = fileStatus.st_size;
+    program->imageMapped = mapped;
+    if (valid) {
+        program->instructions = (ProgramInstruction*) (header + 1);
+        program->numberOfInstructions = header->numberOfInstructions;
+        program->symbols = (Symbol*) (program->instructions + header->numberOfInstructions);
+        program->numberOfSymbols = header->numberOfSymbols;
+        program->identifiers = (char*) (program->symbols + header->numberOfSymbols);
+        program->identifiersSize = header->identifiersSize;
+    }
+
+    for (unsigned int i = 0; valid && i < program->numberOfSymbols; i++) {
+        const Symbol* symbol = &program->symbols[i];
+        valid = symbol->identifierLength > 0 && symbol->identifierOffset <= program->identifiersSize
+            && symbol->identifierLength <= program->identifiersSize - symbol->identifierOffset;
+    }
+    for (unsigned int i = 0; valid && i < program->numberOfInstructions; i++) {
+        const ProgramInstruction* instruction = &program->instructions[i];
+        if (i == 0) {
+            valid = instruction->type == HEADER && instruction->value == header->headerSize && instruction->symbol == NO_SYMBOL;
+        }
+        else if (instruction->type == NEW || instruction->type == MEMORY_ACCESS) {
+            valid = instruction->symbol < program->numberOfSymbols;
+        }
+        else {
+            valid = instruction->type == READ_DISK && instruction->symbol == NO_SYMBOL;
+        }
+    }
+
+    if (!valid) {
+        fprintf(output, COMPILED_FILE_ERROR, fileName);
+        freeTaskProgram(program);
+    }
+    return valid;
+}//loadCompiledTask()
+
+/* Grava o programa de uma tarefa no formato compilado (.tskb).
+   O arquivo é escrito em um arquivo temporário e renomeado ao final, para que um simulador em execução nunca
+   mapeie um arquivo incompleto.
+   Parâmetros:
+   - compiledName: Caminho do arquivo compilado.
+   - program: Programa decodificado de um arquivo de tarefa válido.
+   Retorno:
+   - TRUE se o arquivo foi gravado, FALSE caso contrário.
+*/
+boolean writeCompiledTask(const char *compiledName, const TaskProgram* program) {
+    CompiledTaskHeader header;
+    memset(&header, 0, sizeof(CompiledTaskHeader));
+    memcpy(header.magic, COMPILED_FILE_MAGIC, sizeof(header.magic));
+    header.version = COMPILED_FILE_VERSION;
+    header.byteOrder = COMPILED_FILE_BYTE_ORDER;
+    header.headerSize = program->numberOfInstructions > 0 ? program->instructions[0].value : 0;
+    header.numberOfInstructions = program->numberOfInstructions;
+    header.numberOfSymbols = program->numberOfSymbols;
+    header.identifiersSize = program->identifiersSize;
+
+    FileName temporaryName;
+    if (snprintf(temporaryName, FILE_NAME_SIZE, "%s.tmp", compiledName) >= FILE_NAME_SIZE) {
+        return FALSE;
+    }
+    FILE *compiled = fopen(temporaryName, "wb");
+    if (compiled == NULL) {
+        return FALSE;
+    }
+    fwrite(&header, sizeof(CompiledTaskHeader), 1, compiled);
+    fwrite(program->instructions, sizeof(ProgramInstruction), program->numberOfInstructions, compiled);
+    fwrite(program->symbols, sizeof(Symbol), program->numberOfSymbols, compiled);
+    fwrite(program->identifiers, 1, program->identifiersSize, compiled);
+    boolean written = !ferror(compiled);
+    if (fclose(compiled) != 0 || !written || rename(temporaryName, compiledName) != 0) {
+        remove(temporaryName);
+        return FALSE;
+    }
+    return TRUE;
+}//writeCompiledTask()
+
+/* Valida e carrega um arquivo de tarefa.
+   Esta função mapeia o arquivo de tarefa em memória e decodifica suas instruções diretamente dos bytes mapeados,
+   uma única vez, armazenando-as no programa da tarefa. Arquivos que não podem ser mapeados (pipes) são lidos
+   em blocos. O arquivo é fechado ao final da leitura. Um nome terminado em COMPILED_FILE_EXTENSION é carregado
+   pré-compilado, com 'loadCompiledTask()'.
+   Parâmetros:
+   - fileName: O nome do arquivo de tarefa a ser validado.
+   - program: Programa que recebe as instruções decodificadas.
+   - output: Saída das mensagens de erro.
+   Retorno:
+   - TRUE se o arquivo possui um formato válido, FALSE caso contrário.
+*/
+boolean validateFile(const char *fileName, TaskProgram* program, FILE *output) {
+    size_t length = strlen(fileName);
+    size_t compiledExtensionLength = strlen(COMPILED_FILE_EXTENSION);
+    if (length > compiledExtensionLength && strcmp(fileName + length - compiledExtensionLength, COMPILED_FILE_EXTENSION) == 0) {
+        return loadCompiledTask(fileName, program, output);
+    }
+
+    FileName fullFileName;
+    snprintf(fullFileName, FILE_NAME_SIZE, "%s%s", fileName, FILE_EXTENSION);
+
+    int fileDescriptor = open(fullFileName, O_RDONLY);
+    struct stat fileStatus;
+
+    if (fileDescriptor < 0 || fstat(fileDescriptor, &fileStatus) != 0) {
+        if (fileDescriptor >= 0) {
+            close(fileDescriptor);
+        }
+        fprintf(output, FILE_OPEN_ERROR, fileName);
+        return FALSE;
+    }
+    boolean valid = FALSE;
+
+    if (S_ISREG(fileStatus.st_mode) && fileStatus.st_size == 0) {
+        valid = TRUE;
+    }
+    else {
+        void *mapped = MAP_FAILED;
+        if (S_ISREG(fileStatus.st_mode)) {
+            mapped = mmap(NULL, fileStatus.st_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        }
+
+        if (mapped != MAP_FAILED) {
+            madvise(mapped, fileStatus.st_size, MADV_SEQUENTIAL);
+            valid = parseTaskProgram((const char*)mapped, fileStatus.st_size, program);
+            munmap(mapped, fileStatus.st_size);
+        }
+        else {
+            size_t size;
+            char *buffer = readTaskFileBuffered(fileDescriptor, &size);
+            if (buffer != NULL) {
+                valid = parseTaskProgram(buffer, size, program);
+                free(buffer);
+            }
+        }
+    }
+    close(fileDescriptor);
+
+    if (!valid) {
+        freeTaskProgram(program);
+    }
+    return valid;
+}//validateFile()
+
+// Nomes dos estados das tarefas no registro de execução, indexados por TaskStatus.
+const char *const TRACE_STATUS_NAMES[NUMBER_OF_TASK_STATUS] = {"pronta", "executando", "suspensa", "finalizada"};
+
+/* Abre o arquivo do registro de execução de um cenário e grava o início da lista de eventos.
+   Parâmetros:
+   - file: Arquivo do registro de execução.
+   - fileName: Caminho do arquivo.
+   - output: Saída das mensagens de erro.
+   Retorno:
+   - TRUE se o arquivo foi aberto, FALSE caso contrário.
+*/
+boolean openTraceFile(TraceFile* file, const char *fileName, FILE *output) {
+    file->fileName = fileName;
+    file->numberOfProcesses = 0;
+    file->output = fopen(fileName, "w");
+    if (file->output == NULL) {
+        fprintf(output, TRACE_ERROR, fileName);
+        return FALSE;
+    }
+    fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", file->output);
+    return TRUE;
+}//openTraceFile()
+
+/* Termina a lista de eventos e fecha o arquivo do registro de execução.
+   Parâmetros:
+   - file: Arquivo do registro de execução.
+   - output: Saída das mensagens de erro.
+   Retorno:
+   - TRUE se todo o registro foi gravado, FALSE caso contrário.
+*/
+boolean closeTraceFile(TraceFile* file, FILE *output) {
+    fputs("\n]}\n", file->output);
+    boolean written = !ferror(file->output);
+    if (fclose(file->output) != 0) {
+        written = FALSE;
+    }
+    file->output = NULL;
+    if (!written) {
+        fprintf(output, TRACE_ERROR, file->fileName);
+    }
+    return written;
+}//closeTraceFile()
+
+/* Começa o registro de execução de uma simulação, como um novo processo do arquivo, nomeado pela política de escalonamento,
+   pela substituição de páginas e pelo tamanho de página. Cada tarefa tem uma linha com o seu nome, e cada núcleo uma linha
+   com as tarefas que executou. Todas as tarefas não abortadas começam prontas no instante 0.
+   Parâmetros:
+   - trace: Registro de execução a ser iniciado.
+   - file: Arquivo do registro de execução.
+   - policy: Política de escalonamento da simulação.
+   - replacement: Política de substituição de páginas, ou NULL.
+   - machine: Geometria de memória da simulação.
+   - numberOfCores: Número de núcleos simulados.
+   - tasks: Array de descritores de tarefa, já carregados.
+   - numberOfTasks: Número total de tarefas no array.
+   Retorno:
+   - TRUE se o registro foi iniciado, FALSE se não houve memória disponível.
+*/
+boolean openEventTrace(EventTrace* trace, TraceFile* file, const SchedulingPolicy* policy, const ReplacementPolicy* replacement, const MachineConfiguration* machine, unsigned int numberOfCores, const TaskDescriptor tasks[], int numberOfTasks) {
+    trace->file = file;
+    trace->process = file->numberOfProcesses;
+    trace->tasks = tasks;
+    trace->numberOfTasks = numberOfTasks;
+    trace->numberOfEvents = 0;
+    trace->since = (TimeUnit*)calloc(numberOfTasks, sizeof(TimeUnit));
+    trace->events = (TraceEvent*)malloc(TRACE_BUFFER_EVENTS * sizeof(TraceEvent));
+    if (trace->since == NULL || trace->events == NULL) {
+        free(trace->since);
+        free(trace->events);
+        return FALSE;
+    }
+
+    FILE *output = file->output;
+    String name;
+    snprintf(name, STRING_DEFAULT_SIZE, "%s, %s, página de %u bytes", policy->displayName,
+        replacement != NULL ? replacement->displayName : "páginas residentes", machine->pageSize);
+    fprintf(output, "%s{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%u,\"args\":{\"name\":", trace->process > 0 ? ",\n" : "", trace->process);
+    printJsonString(output, name);
+    fputs("}}", output);
+    for (int i = 0; i < numberOfTasks; i++) {
+        fprintf(output, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%u,\"tid\":%d,\"args\":{\"name\":", trace->process, i);
+        printJsonString(output, tasks[i].task->nameOfTask);
+        fputs("}}", output);
+    }
+    for (unsigned int i = 0; i < numberOfCores; i++) {
+        fprintf(output, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%u,\"tid\":%u,\"args\":{\"name\":\"núcleo %u\"}}",
+            trace->process, numberOfTasks + i, i);
+    }
+    file->numberOfProcesses++;
+    return TRUE;
+}//openEventTrace()
+
+/* Registra a transição de estado de uma tarefa: o intervalo no estado anterior, se não for vazio, e, se a tarefa
+   terminou, o instante do término.
+   Parâmetros:
+   - trace: Registro de execução.
+   - taskDescriptor: Tarefa que muda de estado (ainda no estado anterior).
+   - status: Novo estado da tarefa.
+   - now: Instante simulado da transição.
+*/
+void recordTaskStatus(EventTrace* trace, const TaskDescriptor* taskDescriptor, TaskStatus status, TimeUnit now) {
+    unsigned int task = (unsigned int)(taskDescriptor - trace->tasks);
+    TimeUnit since = trace->since[task];
+    if (now > since) {
+        if (trace->numberOfEvents == TRACE_BUFFER_EVENTS) {
+            flushEventTrace(trace);
+        }
+        TraceEvent *event = &trace->events[trace->numberOfEvents++];
+        event->start = since;
+        event->duration = now - since;
+        event->task = task;
+        event->core = taskDescriptor->core;
+        event->status = taskDescriptor->status;
+        event->aborted = FALSE;
+    }
+    if (status == FINISHED) {
+        if (trace->numberOfEvents == TRACE_BUFFER_EVENTS) {
+            flushEventTrace(trace);
+        }
+        TraceEvent *event = &trace->events[trace->numberOfEvents++];
+        event->start = now;
+        event->duration = 0;
+        event->task = task;
+        event->core = taskDescriptor->core;
+        event->status = FINISHED;
+        event->aborted = taskDescriptor->aborted;
+    }
+    trace->since[task] = now;
+}//recordTaskStatus()
+
+/* Acrescenta um texto a uma linha do registro de execução.
+   Parâmetros:
+   - cursor: Posição da linha que recebe o texto.
+   - text: Texto a ser copiado.
+   Retorno:
+   - Posição seguinte ao texto copiado.
+*/
+char* appendTraceText(char *cursor, const char *text) {
+    size_t length = strlen(text);
+    memcpy(cursor, text, length);
+    return cursor + length;
+}//appendTraceText()
+
+/* Acrescenta um número decimal a uma linha do registro de execução, sem passar pela formatação do printf.
+   Parâmetros:
+   - cursor: Posição da linha que recebe o número.
+   - value: Número a ser escrito.
+   Retorno:
+   - Posição seguinte ao número escrito.
+*/
+char* appendTraceNumber(char *cursor, unsigned int value) {
+    char digits[16];
+    int length = 0;
+    do {
+        digits[length++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+    while (length > 0) {
+        *cursor++ = digits[--length];
+    }
+    return cursor;
+}//appendTraceNumber()
+
+/* Acrescenta um texto entre aspas, escapado como em 'printJsonString()', a uma linha do registro de execução.
+   Parâmetros:
+   - cursor: Posição da linha que recebe o texto.
+   - text: Texto a ser escapado, com até STRING_DEFAULT_SIZE bytes.
+   Retorno:
+   - Posição seguinte ao texto escapado.
+*/
+char* appendTraceString(char *cursor, const char *text) {
+    *cursor++ = '"';
+    for (const unsigned char *c = (const unsigned char*) text; *c != NULL_CHAR; c++) {
+        if (*c == '"' || *c == '\\') {
+            *cursor++ = '\\';
+            *cursor++ = (char) *c;
+        }
+        else if (*c < 0x20) {
+            cursor += sprintf(cursor, "\\u%04x", *c);
+        }
+        else {
+            *cursor++ = (char) *c;
+        }
+    }
+    *cursor++ = '"';
+    return cursor;
+}//appendTraceString()
+
+/* Grava em bloco os eventos acumulados no registro de execução e esvazia o buffer. Os intervalos são eventos completos
+   ('X') na linha da tarefa, e os intervalos em execução são repetidos na linha do núcleo; os términos são eventos
+   instantâneos ('i'). Uma unidade de tempo simulada corresponde a 1 us no visualizador.
+   Parâmetros:
+   - trace: Registro de execução.
+*/
+void flushEventTrace(EventTrace* trace) {
+    char line[TRACE_LINE_SIZE];
+    for (unsigned int i = 0; i < trace->numberOfEvents; i++) {
+        const TraceEvent *event = &trace->events[i];
+        char *cursor = appendTraceText(line, ",\n{\"name\":\"");
+        if (event->status == FINISHED) {
+            cursor = appendTraceText(cursor, event->aborted ? "abortada" : TRACE_STATUS_NAMES[FINISHED]);
+            cursor = appendTraceText(cursor, "\",\"ph\":\"i\",\"s\":\"t\",\"ts\":");
+            cursor = appendTraceNumber(cursor, event->start);
+        }
+        else {
+            cursor = appendTraceText(cursor, TRACE_STATUS_NAMES[event->status]);
+            cursor = appendTraceText(cursor, "\",\"ph\":\"X\",\"ts\":");
+            cursor = appendTraceNumber(cursor, event->start);
+            cursor = appendTraceText(cursor, ",\"dur\":");
+            cursor = appendTraceNumber(cursor, event->duration);
+        }
+        cursor = appendTraceText(cursor, ",\"pid\":");
+        cursor = appendTraceNumber(cursor, trace->process);
+        cursor = appendTraceText(cursor, ",\"tid\":");
+        cursor = appendTraceNumber(cursor, event->task);
+        *cursor++ = '}';
+
+        if (event->status == RUNNING) {
+            cursor = appendTraceText(cursor, ",\n{\"name\":");
+            cursor = appendTraceString(cursor, trace->tasks[event->task].task->nameOfTask);
+            cursor = appendTraceText(cursor, ",\"ph\":\"X\",\"ts\":");
+            cursor = appendTraceNumber(cursor, event->start);
+            cursor = appendTraceText(cursor, ",\"dur\":");
+            cursor = appendTraceNumber(cursor, event->duration);
+            cursor = appendTraceText(cursor, ",\"pid\":");
+            cursor = appendTraceNumber(cursor, trace->process);
+            cursor = appendTraceText(cursor, ",\"tid\":");
+            cursor = appendTraceNumber(cursor, trace->numberOfTasks + event->core);
+            *cursor++ = '}';
+        }
+        fwrite(line, 1, cursor - line, trace->file->output);
+    }
+    trace->numberOfEvents = 0;
+}//flushEventTrace()
+
+/* Grava os eventos restantes e libera o registro de execução de uma simulação.
+   Parâmetros:
+   - trace: Registro de execução.
+*/
+void closeEventTrace(EventTrace* trace) {
+    flushEventTrace(trace);
+    free(trace->since);
+    free(trace->events);
+    trace->since = NULL;
+    trace->events = NULL;
+}//closeEventTrace()
+
+// Pedido de salvar o estado, feito pelo sinal CHECKPOINT_SIGNAL e atendido pela simulação com -k em andamento.
+volatile sig_atomic_t checkpointRequested = FALSE;
+
+/* Trata o sinal CHECKPOINT_SIGNAL, pedindo que o estado da simulação em andamento seja salvo no próximo passo do escalonamento.
+   Parâmetros:
+   - signal: Número do sinal.
+*/
+void requestCheckpoint(int signal) {
+    (void) signal;
+    checkpointRequested = TRUE;
+}//requestCheckpoint()
+
+/* Acumula bytes no hash FNV-1a do estado salvo, uma palavra de 64 bits por vez e os bytes restantes um a um.
+   O hash depende da divisão dos bytes, por isso é sempre calculado sobre os mesmos blocos do arquivo.
+   Parâmetros:
+   - hash: Hash dos bytes anteriores.
+   - data: Bytes acumulados.
+   - size: Quantidade de bytes.
+   Retorno:
+   - Hash atualizado.
+*/
+uint64_t hashSnapshotBytes(uint64_t hash, const void *data, size_t size) {
+    const unsigned char *bytes = (const unsigned char*)data;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, bytes + i, sizeof(word));
+        hash ^= word;
+        hash *= FNV64_PRIME;
+    }
+    for (; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= FNV64_PRIME;
+    }
+    return hash;
+}//hashSnapshotBytes()
+
+/* Grava no arquivo o bloco do estado salvo e o inclui no hash.
+   Parâmetros:
+   - stream: Arquivo do estado salvo, aberto para gravação.
+*/
+void flushSnapshotBlock(SnapshotStream* stream) {
+    if (stream->failed || stream->position == 0) {
+        return;
+    }
+    stream->checksum = hashSnapshotBytes(stream->checksum, stream->block, stream->position);
+    stream->failed = fwrite(stream->block, 1, stream->position, stream->file) != stream->position;
+    stream->position = 0;
+}//flushSnapshotBlock()
+
+/* Grava ou lê bytes do estado salvo, conforme o sentido do arquivo, através do bloco em memória. Depois de uma falha,
+   nada mais é transferido.
+   Parâmetros:
+   - stream: Arquivo do estado salvo.
+   - data: Bytes gravados ou que recebem os bytes lidos.
+   - size: Quantidade de bytes.
+*/
+void transferSnapshotBytes(SnapshotStream* stream, void *data, size_t size) {
+    unsigned char *bytes = (unsigned char*)data;
+    while (!stream->failed && !stream->mismatched && size > 0) {
+        if (stream->restoring && stream->position == stream->length) {
+            stream->length = fread(stream->block, 1, SNAPSHOT_BUFFER_SIZE, stream->file);
+            stream->position = 0;
+            stream->failed = stream->length == 0;
+            continue;
+        }
+        if (!stream->restoring && stream->position == SNAPSHOT_BUFFER_SIZE) {
+            flushSnapshotBlock(stream);
+            continue;
+        }
+        size_t available = (stream->restoring ? stream->length : SNAPSHOT_BUFFER_SIZE) - stream->position;
+        size_t count = size < available ? size : available;
+        if (stream->restoring) {
+            memcpy(bytes, stream->block + stream->position, count);
+        }
+        else {
+            memcpy(stream->block + stream->position, bytes, count);
+        }
+        stream->position += count;
+        bytes += count;
+        size -= count;
+    }
+}//transferSnapshotBytes()
+
+/* Grava ou lê a referência a uma tarefa, pelo seu índice na tabela de tarefas.
+   Parâmetros:
+   - stream: Arquivo do estado salvo.
+   - reference: Tarefa referenciada, ou NULL; ignorada na leitura.
+   - tasks: Array de descritores de tarefa.
+   - numberOfTasks: Número total de tarefas no array.
+   Retorno:
+   - Tarefa referenciada, ou NULL se a referência é nula ou inválida (a leitura é marcada como falha).
+*/
+TaskDescriptor* transferTaskReference(SnapshotStream* stream, const TaskDescriptor* reference, TaskDescriptor tasks[], int numberOfTasks) {
+    unsigned int index = NO_TASK_REFERENCE;
+    if (!stream->restoring && reference != NULL) {
+        index = (unsigned int)(reference - tasks);
+    }
+    TRANSFER_SNAPSHOT(stream, index);
+    if (index == NO_TASK_REFERENCE || stream->failed) {
+        return NULL;
+    }
+    if (index >= (unsigned int) numberOfTasks) {
+        stream->failed = TRUE;
+        return NULL;
+    }
+    return &tasks[index];
+}//transferTaskReference()
+
+/* Grava um valor da configuração da simulação ou, na leitura, confere se o valor salvo é o mesmo.
+   Parâmetros:
+   - stream: Arquivo do estado salvo.
+   - value: Valor da simulação atual.
+*/
+void matchSnapshotValue(SnapshotStream* stream, unsigned int value) {
+    unsigned int saved = value;
+    TRANSFER_SNAPSHOT(stream, saved);
+    if (saved != value) {
+        stream->mismatched = TRUE;
+    }
+}//matchSnapshotValue()
+
+/* Grava um texto da configuração da simulação, precedido do seu tamanho, ou, na leitura, confere se o texto salvo é o mesmo.
+   Parâmetros:
+   - stream: Arquivo do estado salvo.
+   - text: Texto da simulação atual.
+*/
+void matchSnapshotString(SnapshotStream* stream, const char *text) {
+    unsigned int length = (unsigned int) strlen(text);
+    matchSnapshotValue(stream, length);
+    if (!stream->restoring) {
+        transferSnapshotBytes(stream, (void*)text, length);
+        return;
+    }
+    String saved;
+    for (unsigned int offset = 0; offset < length && !stream->failed && !stream->mismatched; offset += STRING_DEFAULT_SIZE) {
+        unsigned int size = length - offset < STRING_DEFAULT_SIZE ? length - offset : STRING_DEFAULT_SIZE;
+        transferSnapshotBytes(stream, saved, size);
+        if (!stream->failed && memcmp(saved, text + offset, size) != 0) {
+            stream->mismatched = TRUE;
+        }
+    }
+}//matchSnapshotString()
+
+/* Grava ou lê um texto do estado da simulação, precedido do seu tamanho.
+   Parâmetros:
+   - stream: Arquivo do estado salvo.
+   - text: Texto gravado ou que recebe o texto lido.
+   - size: Capacidade de 'text', incluindo o caractere nulo.
+*/
+void transferSnapshotString(SnapshotStream* stream, char *text, size_t size) {
+    unsigned int length = (unsigned int) strnlen(text, size);
+    TRANSFER_SNAPSHOT(stream, length);
+    if (length >= size) {
+        stream->failed = TRUE;
+        return;
+    }
+    transferSnapshotBytes(stream, text, length);
+    text[length] = NULL_CHAR;
+}//transferSnapshotString()
+
+/* Grava ou lê uma fila de descritores, na ordem da fila. Na leitura, a fila deve estar vazia.
+   Parâmetros:
+   - stream: Arquivo do estado salvo.
+   - queue: Fila gravada ou que recebe os descritores lidos.
+   - tasks: Array de descritores de tarefa.
+   - numberOfTasks: Número total de tarefas no array.
+*/
+void transferTaskQueue(SnapshotStream* stream, TaskDescriptorQueue* queue, TaskDescriptor tasks[], int numberOfTasks) {
+    unsigned int length = 0;
+    for (TaskDescriptor* taskDescriptor = queue->front; taskDescriptor != NULL; taskDescriptor = taskDescriptor->next) {
+        length++;
+    }
+    TRANSFER_SNAPSHOT(stream, length);
+    if (!stream->restoring) {
+        for (TaskDescriptor* taskDescriptor = queue->front; taskDescriptor != NULL; taskDescriptor = taskDescriptor->next) {
+            transferTaskReference(stream, taskDescriptor, tasks, numberOfTasks);
+        }
+        return;
+    }
+    for (unsigned int i = 0; i < length && !stream->failed; i++) {
+        TaskDescriptor* taskDescriptor = transferTaskReference(stream, NULL, tasks, numberOfTasks);
+        if (taskDescriptor == NULL) {
+            stream->failed = TRUE;
+            break;
+        }
+        enqueueTaskDescriptor(queue, taskDescriptor);
+    }
+}//transferTaskQueue()
+
+/* Grava ou lê um heap de descritores com a disposição exata do seu vetor, de modo que os empates continuem
+   sendo desfeitos como na simulação salva. Na leitura, o heap deve estar vazio.
+   Parâmetros:
+   - stream: Arquivo do estado salvo.
+   - heap: Heap gravado ou que recebe os descritores lidos.
+   - tasks: Array de descritores de tarefa.
+   - numberOfTasks: Número total de tarefas no array.
+*/
+void transferTaskHeap(SnapshotStream* stream, TaskDescriptorHeap* heap, TaskDescriptor tasks[], int numberOfTasks) {
+    int size = heap->size;
+    TRANSFER_SNAPSHOT(stream, size);
+    if (stream->failed) {
+        return;
+    }
+    if (stream->restoring) {
+        if (size < 0 || size > numberOfTasks) {
+            stream->failed = TRUE;
+            return;
+        }
+        if (size > heap->capacity) {
+            TaskDescriptor** items = (TaskDescriptor**)realloc(heap->items, size * sizeof(TaskDescriptor*));
+            if (items == NULL) {
+                stream->failed = TRUE;
+                return;
+            }
+            heap->items = items;
+            heap->capacity = size;
+        }
+    }
+    for (int i = 0; i < size && !stream->failed; i++) {
+        heap->items[i] = transferTaskReference(stream, stream->restoring ? NULL : heap->items[i], tasks, numberOfTasks);
+        if (heap->items[i] == NULL) {
+            stream->failed = TRUE;
+        }
+    }
+    if (stream->restoring && !stream->failed) {
+        heap->size = size;
+    }
+}//transferTaskHeap()
+
+/* Grava ou lê os dados de memória de uma tarefa: variáveis, tabela de páginas, contadores, registro de acessos e,
+   se a tarefa não terminou, o mapa de símbolo para variável. Na leitura, as variáveis, a tabela de páginas e o registro
+   de acessos devem estar vazios.
+   Parâmetros:
+   - stream: Arquivo do estado salvo.
+   - memory: Dados de memória gravados ou que recebem os dados lidos.
+   - numberOfSymbols: Número de símbolos do programa da tarefa.
+*/
+void transferTaskMemory(SnapshotStream* stream, TaskMemory* memory, unsigned int numberOfSymbols) {
+    TRANSFER_SNAPSHOT(stream, memory->quantityVariables);
+    if (stream->restoring && !stream->failed && memory->quantityVariables > 0) {
+        memory->variables = (Variable*)malloc(memory->quantityVariables * sizeof(Variable));
+        memory->variablesCapacity = memory->quantityVariables;
+        if (memory->variables == NULL) {
+            memory->quantityVariables = 0;
+            memory->variablesCapacity = 0;
+            stream->failed = TRUE;
+            return;
+        }
+    }
+    for (unsigned int i = 0; i < memory->quantityVariables && !stream->failed; i++) {
+        Variable* variable = &memory->variables[i];
+        transferSnapshotString(stream, variable->name, STRING_DEFAULT_SIZE);
+        TRANSFER_SNAPSHOT(stream, variable->value);
+        TRANSFER_SNAPSHOT(stream, variable->logicalMemory.logicalInitialByte);
+        TRANSFER_SNAPSHOT(stream, variable->logicalMemory.logicalFinalByte);
+    }
+
+    Pagination* pagination = &memory->pagination;
+    TRANSFER_SNAPSHOT(stream, pagination->bytesAllocated);
+    TRANSFER_SNAPSHOT(stream, pagination->finalPage);
+    TRANSFER_SNAPSHOT(stream, pagination->mappedPages);
+    if (stream->restoring && !stream->failed && pagination->mappedPages > 0) {
+        pagination->frames = (unsigned int*)malloc(pagination->mappedPages * sizeof(unsigned int));
+        pagination->pageTableCapacity = pagination->mappedPages;
+        if (pagination->frames == NULL) {
+            pagination->mappedPages = 0;
+            pagination->pageTableCapacity = 0;
+            stream->failed = TRUE;
+            return;
+        }
+    }
+    transferSnapshotBytes(stream, pagination->frames, pagination->mappedPages * sizeof(unsigned int));
+    TRANSFER_SNAPSHOT(stream, memory->pageFaults);
+    TRANSFER_SNAPSHOT(stream, memory->tlbHits);
+    TRANSFER_SNAPSHOT(stream, memory->tlbMisses);
+
+    // Os acessos são gravados em sequência, sem a divisão em blocos; a leitura os distribui em blocos do tamanho máximo.
+    MemoryAccessLog* accessLog = &memory->accessLog;
+    unsigned long long numberOfAccesses = accessLog->numberOfAccesses;
+    TRANSFER_SNAPSHOT(stream, numberOfAccesses);
+    if (!stream->restoring) {
+        for (MemoryAccessChunk* chunk = accessLog->head; chunk != NULL; chunk = chunk->next) {
+            transferSnapshotBytes(stream, chunk->records, chunk->size * sizeof(MemoryAccessRecord));
+        }
+    }
+    while (stream->restoring && !stream->failed && accessLog->numberOfAccesses < numberOfAccesses) {
+        unsigned long long remaining = numberOfAccesses - accessLog->numberOfAccesses;
+        unsigned int capacity = remaining < MAXIMUM_ACCESS_LOG_CHUNK_SIZE ? (unsigned int) remaining : MAXIMUM_ACCESS_LOG_CHUNK_SIZE;
+        MemoryAccessChunk* chunk = (MemoryAccessChunk*)malloc(sizeof(MemoryAccessChunk) + capacity * sizeof(MemoryAccessRecord));
+        if (chunk == NULL) {
+            stream->failed = TRUE;
+            return;
+        }
+        chunk->next = NULL;
+        chunk->size = capacity;
+        chunk->capacity = capacity;
+        if (accessLog->tail == NULL) {
+            accessLog->head = chunk;
+        }
+        else {
+            accessLog->tail->next = chunk;
+        }
+        accessLog->tail = chunk;
+        accessLog->numberOfAccesses += capacity;
+        transferSnapshotBytes(stream, chunk->records, capacity * sizeof(MemoryAccessRecord));
+    }
+
+    // O mapa de símbolos é liberado quando a tarefa termina.
+    boolean mapped = memory->symbolVariables != NULL;
+    TRANSFER_SNAPSHOT(stream, mapped);
+    if (stream->restoring && !stream->failed && !mapped) {
+        free(memory->symbolVariables);
+        memory->symbolVariables = NULL;
+    }
+    if (mapped && memory->symbolVariables == NULL) {
+        stream->mismatched = TRUE;
+        return;
+    }
+    if (mapped) {
+        transferSnapshotBytes(stream, memory->symbolVariables, numberOfSymbols * sizeof(int));
+    }
+}//transferTaskMemory()
+
+/* Grava ou lê o conjunto de programas residentes: as suas estatísticas, a lista LRU, da tarefa usada mais recentemente
+   à menos recente, e a tarefa protegida do descarte. Na leitura, os programas ausentes da lista são descartados e os
+   que faltam são recarregados dos arquivos, de modo que os descartes e as recargas seguintes sejam os da simulação salva.
+   Parâmetros:
+   - stream: Arquivo do estado salvo.
+   - pool: Conjunto de programas residentes.
+   - tasks: Array de descritores de tarefa.
+   - numberOfTasks: Número total de tarefas no array.
+*/
+void transferProgramPool(SnapshotStream* stream, ProgramPool* pool, TaskDescriptor tasks[], int numberOfTasks) {
+    TRANSFER_SNAPSHOT(stream, pool->peakResidentPrograms);
+    TRANSFER_SNAPSHOT(stream, pool->reloads);
+    TaskDescriptor* pinned = transferTaskReference(stream, pool->pinned != NULL ? &tasks[pool->pinned - tasks->task] : NULL, tasks, numberOfTasks);
+    pool->pinned = pinned != NULL ? pinned->task : NULL;
+
+    unsigned int residentPrograms = pool->residentPrograms;
+    TRANSFER_SNAPSHOT(stream, residentPrograms);
+    if (!stream->restoring) {
+        for (Task* task = pool->mostRecent; task != NULL; task = task->lessRecent) {
+            transferTaskReference(stream, &tasks[task - tasks->task], tasks, numberOfTasks);
+        }
+        return;
+    }
+    if (stream->failed || residentPrograms > (unsigned int) numberOfTasks) {
+        stream->failed = TRUE;
+        return;
+    }
+    TaskDescriptor** resident = (TaskDescriptor**)malloc((residentPrograms > 0 ? residentPrograms : 1) * sizeof(TaskDescriptor*));
+    if (resident == NULL) {
+        stream->failed = TRUE;
+        return;
+    }
+    for (unsigned int i = 0; i < residentPrograms && !stream->failed; i++) {
+        resident[i] = transferTaskReference(stream, NULL, tasks, numberOfTasks);
+        if (resident[i] == NULL) {
+            stream->failed = TRUE;
+        }
+    }
+
+    // Da menos recente à mais recente, cada tarefa da lista salva passa para o início da lista; as demais ficam no fim e são descartadas.
+    for (unsigned int i = residentPrograms; i > 0 && !stream->failed && !stream->mismatched; i--) {
+        Task* task = resident[i - 1]->task;
+        if (task->pool != pool) {
+            stream->mismatched = TRUE;
+        }
+        else if (task->resident) {
+            unlinkResidentProgram(pool, task);
+            linkResidentProgram(pool, task);
+        }
+        else if (!validateFile(task->fileName, &task->program, pool->output)) {
+            stream->mismatched = TRUE;
+        }
+        else if (task->program.numberOfInstructions != task->numberOfInstructions || task->program.numberOfSymbols != task->numberOfSymbols) {
+            freeTaskProgram(&task->program);
+            stream->mismatched = TRUE;
+        }
+        else {
+            linkResidentProgram(pool, task);
+        }
+    }
+    while (!stream->failed && !stream->mismatched && pool->residentPrograms > residentPrograms) {
+        Task* task = pool->leastRecent;
+        unlinkResidentProgram(pool, task);
+        freeTaskProgram(&task->program);
+    }
+    free(resident);
+}//transferProgramPool()
+
+/* Grava ou lê o estado completo de uma simulação entre dois passos do escalonamento. O arquivo começa com a identificação
+   e com a configuração da simulação, conferida na leitura: política de escalonamento e de substituição de páginas,
+   geometria de memória (exceto o quantum), TLB, núcleos, limite de programas residentes e, para cada tarefa, o arquivo e
+   as contagens de instruções e de símbolos do programa. Seguem os contadores da simulação, o alocador de quadros, o
+   escalonador (relógios, estruturas de prontos da política, TLBs, fila de despertar e fila de espera por memória), os
+   descritores e os dados de memória das tarefas e o conjunto de programas residentes; os programas em si não são salvos,
+   pois são recarregados dos arquivos das tarefas, que continuam dos seus contadores de programa.
+   Na leitura, o escalonador e o alocador de quadros devem estar recém-inicializados e as tarefas, recém-carregadas.
+   Parâmetros:
+   - stream: Arquivo do estado salvo.
+   - scheduler: Ponteiro para o escalonador.
+   - roundRobin: Estrutura RoundRobin com os contadores, o alocador de quadros e a configuração da simulação.
+   - tasks: Array de descritores de tarefa.
+   - numberOfTasks: Número total de tarefas no array.
+   - pool: Conjunto de programas residentes.
+*/
+void transferSimulationState(SnapshotStream* stream, Scheduler* scheduler, RoundRobin* roundRobin, TaskDescriptor tasks[], int numberOfTasks, ProgramPool* pool) {
+    char magic[4];
+    memcpy(magic, SNAPSHOT_MAGIC, sizeof(magic));
+    unsigned int version = SNAPSHOT_VERSION;
+    unsigned int byteOrder = SNAPSHOT_BYTE_ORDER;
+    TRANSFER_SNAPSHOT(stream, magic);
+    TRANSFER_SNAPSHOT(stream, version);
+    TRANSFER_SNAPSHOT(stream, byteOrder);
+    if (memcmp(magic, SNAPSHOT_MAGIC, sizeof(magic)) != 0 || version != SNAPSHOT_VERSION || byteOrder != SNAPSHOT_BYTE_ORDER) {
+        stream->failed = TRUE;
+        return;
+    }
+
+    // Configuração da simulação.
+    const ReplacementPolicy* replacement = roundRobin->frameAllocator.replacement;
+    matchSnapshotString(stream, scheduler->policy->name);
+    matchSnapshotString(stream, replacement != NULL ? replacement->name : "");
+    matchSnapshotValue(stream, roundRobin->machine.pageSize);
+    matchSnapshotValue(stream, roundRobin->machine.physicalMemorySize);
+    matchSnapshotValue(stream, roundRobin->machine.logicalMemorySize);
+    matchSnapshotValue(stream, roundRobin->tlb.entries);
+    matchSnapshotValue(stream, roundRobin->tlb.ways);
+    matchSnapshotValue(stream, roundRobin->tlb.replacement);
+    matchSnapshotValue(stream, roundRobin->tlb.asid);
+    matchSnapshotValue(stream, roundRobin->numberOfCores);
+    matchSnapshotValue(stream, pool->capacity);
+    matchSnapshotValue(stream, numberOfTasks);
+    for (int i = 0; i < numberOfTasks; i++) {
+        matchSnapshotString(stream, tasks[i].task->fileName);
+        matchSnapshotValue(stream, tasks[i].numberOfInstructions);
+        matchSnapshotValue(stream, tasks[i].task->numberOfSymbols);
+    }
+
+    // Contadores da simulação.
+    TRANSFER_SNAPSHOT(stream, roundRobin->totalCPUClocks);
+    TRANSFER_SNAPSHOT(stream, roundRobin->totalOutputTime);
+    TRANSFER_SNAPSHOT(stream, roundRobin->waitTime);
+    TRANSFER_SNAPSHOT(stream, roundRobin->preemptionTimeCounter);
+    TRANSFER_SNAPSHOT(stream, roundRobin->tasksPerStatus);
+    TRANSFER_SNAPSHOT(stream, roundRobin->abortedTasks);
+    transferSnapshotBytes(stream, roundRobin->cores, roundRobin->numberOfCores * sizeof(CoreStatistics));
+    TRANSFER_SNAPSHOT(stream, roundRobin->migrations);
+    TRANSFER_SNAPSHOT(stream, roundRobin->idleTime);
+    TRANSFER_SNAPSHOT(stream, roundRobin->memoryWaits);
+    TRANSFER_SNAPSHOT(stream, roundRobin->memoryAccesses);
+    TRANSFER_SNAPSHOT(stream, roundRobin->pageFaults);
+    TRANSFER_SNAPSHOT(stream, roundRobin->pageReplacements);
+    TRANSFER_SNAPSHOT(stream, roundRobin->tlbHits);
+    TRANSFER_SNAPSHOT(stream, roundRobin->tlbMisses);
+    TRANSFER_SNAPSHOT(stream, roundRobin->tlbFlushes);
+
+    // Quadros da memória física.
+    FrameAllocator* allocator = &roundRobin->frameAllocator;
+    transferSnapshotBytes(stream, allocator->freeFrames, allocator->bitmapWords * sizeof(unsigned long long));
+    TRANSFER_SNAPSHOT(stream, allocator->numberOfFreeFrames);
+    TRANSFER_SNAPSHOT(stream, allocator->numberOfReservedFrames);
+    TRANSFER_SNAPSHOT(stream, allocator->peakFramesInUse);
+    TRANSFER_SNAPSHOT(stream, allocator->references);
+    TRANSFER_SNAPSHOT(stream, allocator->clockHand);
+    for (unsigned int i = 0; i < roundRobin->machine.numberOfFrames; i++) {
+        PhysicalFrame* frame = &allocator->frames[i];
+        frame->owner = transferTaskReference(stream, frame->owner, tasks, numberOfTasks);
+        TRANSFER_SNAPSHOT(stream, frame->page);
+        TRANSFER_SNAPSHOT(stream, frame->loadTime);
+        TRANSFER_SNAPSHOT(stream, frame->lastUse);
+        TRANSFER_SNAPSHOT(stream, frame->referenced);
+    }
+
+    // Escalonador.
+    TRANSFER_SNAPSHOT(stream, scheduler->readySequence);
+    TRANSFER_SNAPSHOT(stream, scheduler->feedbackEpoch);
+    TRANSFER_SNAPSHOT(stream, scheduler->nextFeedbackBoost);
+    TRANSFER_SNAPSHOT(stream, scheduler->minVirtualRuntime);
+    TRANSFER_SNAPSHOT(stream, scheduler->clock);
+    TRANSFER_SNAPSHOT(stream, scheduler->suspensions);
+    TRANSFER_SNAPSHOT(stream, scheduler->nextArrival);
+    for (unsigned int i = 0; i < scheduler->numberOfCores; i++) {
+        Core* core = &scheduler->cores[i];
+        TRANSFER_SNAPSHOT(stream, core->clock);
+        TRANSFER_SNAPSHOT(stream, core->numberOfReadyTasks);
+        for (int level = 0; level < NUMBER_OF_FEEDBACK_LEVELS; level++) {
+            transferTaskQueue(stream, core->readyQueues[level], tasks, numberOfTasks);
+        }
+        if (core->readyHeap != NULL) {
+            transferTaskHeap(stream, core->readyHeap, tasks, numberOfTasks);
+        }
+        TRANSFER_SNAPSHOT(stream, core->tlb.lookups);
+        core->tlb.lastTask = transferTaskReference(stream, core->tlb.lastTask, tasks, numberOfTasks);
+        for (unsigned int j = 0; j < roundRobin->tlb.entries; j++) {
+            TlbEntry* entry = &core->tlb.entries[j];
+            entry->task = transferTaskReference(stream, entry->task, tasks, numberOfTasks);
+            TRANSFER_SNAPSHOT(stream, entry->page);
+            TRANSFER_SNAPSHOT(stream, entry->frame);
+            TRANSFER_SNAPSHOT(stream, entry->insertedAt);
+            TRANSFER_SNAPSHOT(stream, entry->lastUse);
+            TRANSFER_SNAPSHOT(stream, entry->valid);
+        }
+    }
+    transferTaskHeap(stream, scheduler->wakeUpQueue, tasks, numberOfTasks);
+    transferTaskQueue(stream, scheduler->memoryWaitQueue, tasks, numberOfTasks);
+
+    // Tarefas.
+    for (int i = 0; i < numberOfTasks && !stream->failed && !stream->mismatched; i++) {
+        TaskDescriptor* taskDescriptor = &tasks[i];
+        TRANSFER_SNAPSHOT(stream, taskDescriptor->programCounter);
+        TRANSFER_SNAPSHOT(stream, taskDescriptor->status);
+        TRANSFER_SNAPSHOT(stream, taskDescriptor->wakeUpTime);
+        TRANSFER_SNAPSHOT(stream, taskDescriptor->wakeUpSequence);
+        TRANSFER_SNAPSHOT(stream, taskDescriptor->readySequence);
+        TRANSFER_SNAPSHOT(stream, taskDescriptor->virtualRuntime);
+        TRANSFER_SNAPSHOT(stream, taskDescriptor->priority);
+        TRANSFER_SNAPSHOT(stream, taskDescriptor->core);
+        TRANSFER_SNAPSHOT(stream, taskDescriptor->feedbackLevel);
+        TRANSFER_SNAPSHOT(stream, taskDescriptor->feedbackEpoch);
+        TRANSFER_SNAPSHOT(stream, taskDescriptor->startTime);
+        TRANSFER_SNAPSHOT(stream, taskDescriptor->endTime);
+        TRANSFER_SNAPSHOT(stream, taskDescriptor->readyTime);
+        TRANSFER_SNAPSHOT(stream, taskDescriptor->cpuTime);
+        TRANSFER_SNAPSHOT(stream, taskDescriptor->aborted);
+        TRANSFER_SNAPSHOT(stream, taskDescriptor->inputOutputTime);
+        TRANSFER_SNAPSHOT(stream, taskDescriptor->memoryAdmitted);
+        TRANSFER_SNAPSHOT(stream, taskDescriptor->framesReserved);
+        TRANSFER_SNAPSHOT(stream, taskDescriptor->framesWanted);
+        if (taskDescriptor->core >= scheduler->numberOfCores || (unsigned int) taskDescriptor->status >= NUMBER_OF_TASK_STATUS) {
+            stream->failed = TRUE;
+        }
+        transferTaskMemory(stream, taskDescriptor->memory, taskDescriptor->task->numberOfSymbols);
+    }
+    transferProgramPool(stream, pool, tasks, numberOfTasks);
+}//transferSimulationState()
+
+/* Salva o estado da simulação no arquivo do estado salvo. O estado é gravado em um arquivo temporário, seguido do hash
+   dos seus bytes, e só então substitui o estado salvo anterior, que continua válido se a gravação for interrompida.
+   Parâmetros:
+   - checkpoint: Arquivo e instante do estado salvo; 'saveFailed' é marcado se a gravação falhar.
+   - scheduler: Ponteiro para o escalonador.
+   - roundRobin: Estrutura de informações do Round-Robin.
+   - tasks: Array de descritores de tarefa.
+   - numberOfTasks: Número total de tarefas no array.
+   Retorno:
+   - TRUE se o estado foi salvo, FALSE caso contrário.
+*/
+boolean saveSnapshot(Checkpoint* checkpoint, Scheduler* scheduler, RoundRobin* roundRobin, TaskDescriptor tasks[], int numberOfTasks) {
+    FileName temporaryName;
+    FILE *file = NULL;
+    if (snprintf(temporaryName, FILE_NAME_SIZE, "%s%s", checkpoint->saveFileName, SNAPSHOT_TEMPORARY_EXTENSION) < FILE_NAME_SIZE) {
+        file = fopen(temporaryName, "wb");
+    }
+    if (file == NULL) {
+        fprintf(checkpoint->output, SNAPSHOT_SAVE_ERROR, checkpoint->saveFileName);
+        checkpoint->saveFailed = TRUE;
+        return FALSE;
+    }
+
+    SnapshotStream stream = {file, FALSE, (unsigned char*)malloc(SNAPSHOT_BUFFER_SIZE), 0, 0, FALSE, FALSE, FNV64_OFFSET_BASIS};
+    stream.failed = stream.block == NULL;
+    transferSimulationState(&stream, scheduler, roundRobin, tasks, numberOfTasks, checkpoint->pool);
+    flushSnapshotBlock(&stream);
+    boolean saved = !stream.failed && fwrite(&stream.checksum, sizeof(stream.checksum), 1, file) == 1 && !ferror(file);
+    if (fclose(file) != 0) {
+        saved = FALSE;
+    }
+    free(stream.block);
+    if (saved && rename(temporaryName, checkpoint->saveFileName) != 0) {
+        saved = FALSE;
+    }
+    if (!saved) {
+        remove(temporaryName);
+        fprintf(checkpoint->output, SNAPSHOT_SAVE_ERROR, checkpoint->saveFileName);
+        checkpoint->saveFailed = TRUE;
+    }
+    return saved;
+}//saveSnapshot()
+
+/* Confere o hash do estado salvo antes da leitura, para que um arquivo truncado ou corrompido não seja aplicado à simulação.
+   O hash é calculado sobre os mesmos blocos da gravação.
+   Parâmetros:
+   - stream: Arquivo do estado salvo, aberto para leitura e posicionado no início; o seu bloco é usado na leitura.
+   Retorno:
+   - TRUE se o hash gravado ao final do arquivo corresponde aos bytes anteriores, FALSE caso contrário.
+*/
+boolean verifySnapshotChecksum(SnapshotStream* stream) {
+    struct stat fileStatus;
+    if (fstat(fileno(stream->file), &fileStatus) != 0 || fileStatus.st_size < (off_t) sizeof(uint64_t)) {
+        return FALSE;
+    }
+
+    uint64_t checksum = FNV64_OFFSET_BASIS;
+    off_t remaining = fileStatus.st_size - sizeof(uint64_t);
+    while (remaining > 0) {
+        size_t size = remaining < SNAPSHOT_BUFFER_SIZE ? (size_t) remaining : SNAPSHOT_BUFFER_SIZE;
+        if (fread(stream->block, 1, size, stream->file) != size) {
+            return FALSE;
+        }
+        checksum = hashSnapshotBytes(checksum, stream->block, size);
+        remaining -= size;
+    }
+    uint64_t saved;
+    return fread(&saved, sizeof(saved), 1, stream->file) == 1 && saved == checksum;
+}//verifySnapshotChecksum()
+
+/* Restaura o estado salvo de uma simulação no lugar da admissão das tarefas, para que a simulação continue do passo
+   em que o estado foi salvo e produza o mesmo resultado da execução sem interrupção. O quantum é o da simulação atual.
+   Parâmetros:
+   - checkpoint: Arquivo do estado restaurado, conjunto de programas residentes e saída das mensagens de erro.
+   - scheduler: Ponteiro para o escalonador, recém-inicializado.
+   - roundRobin: Estrutura de informações do Round-Robin, recém-inicializada.
+   - tasks: Array de descritores de tarefa, recém-carregados.
+   - numberOfTasks: Número total de tarefas no array.
    Retorno:
-   - TRUE se o acesso à memória foi realizado com sucesso; FALSE caso contrário.
+   - TRUE se o estado foi restaurado, FALSE se o arquivo não pôde ser lido, está corrompido ou é de outra simulação.
 */
-boolean memoryAccess(String instruction, TaskDescriptor* taskDescriptor, RoundRobin* roundRobin) {
-    String identifier;
-    unsigned int value;
-    sscanf(instruction, "%[^[][%d]", identifier, &value);
-    for (int i = 0; i < taskDescriptor->quantityVariables; i++) {
-        if (strcmp(taskDescriptor->variable[i].name, identifier) == 0) {
-            if (value >= taskDescriptor->variable[i].value) {
-                printf(MEMORY_ACCESS_ERROR, taskDescriptor->task.nameOfTask, identifier, value);
-                finishTask(taskDescriptor, TRUE, roundRobin);
+boolean restoreSnapshot(Checkpoint* checkpoint, Scheduler* scheduler, RoundRobin* roundRobin, TaskDescriptor tasks[], int numberOfTasks) {
+    FILE *file = fopen(checkpoint->restoreFileName, "rb");
+    if (file == NULL) {
+        fprintf(checkpoint->output, SNAPSHOT_RESTORE_ERROR, checkpoint->restoreFileName);
+        return FALSE;
+    }
+
+    SnapshotStream stream = {file, TRUE, (unsigned char*)malloc(SNAPSHOT_BUFFER_SIZE), 0, 0, FALSE, FALSE, FNV64_OFFSET_BASIS};
+    stream.failed = stream.block == NULL || !verifySnapshotChecksum(&stream) || fseek(file, 0, SEEK_SET) != 0;
+    transferSimulationState(&stream, scheduler, roundRobin, tasks, numberOfTasks, checkpoint->pool);
+    uint64_t checksum;
+    TRANSFER_SNAPSHOT(&stream, checksum);
+    boolean restored = !stream.failed && !stream.mismatched && stream.position == stream.length && fgetc(file) == EOF;
+    fclose(file);
+    free(stream.block);
+    if (!restored) {
+        fprintf(checkpoint->output, stream.mismatched ? SNAPSHOT_MISMATCH_ERROR : SNAPSHOT_RESTORE_ERROR, checkpoint->restoreFileName);
+        return FALSE;
+    }
+
+    // O registro de execução começa no instante restaurado, ou na chegada de uma tarefa que ainda não chegou.
+    if (roundRobin->trace != NULL) {
+        for (int i = 0; i < numberOfTasks; i++) {
+            roundRobin->trace->since[i] = tasks[i].startTime > scheduler->clock ? tasks[i].startTime : scheduler->clock;
+        }
+    }
+    return TRUE;
+}//restoreSnapshot()
+
+/* Executa uma simulação completa com uma política de escalonamento e imprime os relatórios.
+   Cada simulação carrega os arquivos de tarefa em uma tabela de tarefas própria, alocada no heap,
+   para que várias políticas possam ser comparadas sobre a mesma carga de trabalho. A simulação não usa
+   estado global mutável, podendo executar em paralelo com outras simulações.
+   Parâmetros:
+   - taskList: Lista de tarefas a serem escalonadas.
+   - policy: Política de escalonamento.
+   - replacement: Política de substituição de páginas, ou NULL para manter as páginas residentes.
+   - tlb: Configuração da TLB dos núcleos.
+   - machine: Geometria de memória e quantum, já configurados por 'configureMachine()'.
+   - numberOfCores: Número de núcleos simulados.
+   - residentPrograms: Limite de programas decodificados residentes, ou 0 para manter todos.
+   - traceFile: Arquivo do registro de execução, que recebe a simulação como um novo processo, ou NULL.
+   - checkpoint: Estado salvo (-k) e restaurado (-R) da simulação, ou NULL.
+   - reportFormat: Formato do relatório; nos formatos lidos por programas, as mensagens de erro das tarefas vão para stderr.
+   - output: Saída dos relatórios.
+   Retorno:
+   - EXIT_SUCCESS se a execução for bem-sucedida, EXIT_FAILURE caso contrário.
+*/
+int runSimulation(TaskList* taskList, const SchedulingPolicy* policy, const ReplacementPolicy* replacement, const TlbConfiguration* tlb, const MachineConfiguration* machine, unsigned int numberOfCores, unsigned int residentPrograms, TraceFile* traceFile, Checkpoint* checkpoint, const ReportFormat* reportFormat, FILE *output) {
+    int numberOfTasks = taskList->numberOfTasks;
+    TaskTable table;
+    if (!createTaskTable(&table, numberOfTasks)) {
+        perror(TASK_LIST_ERROR);
+        return EXIT_FAILURE;
+    }
+
+    FILE *diagnostics = reportFormat->machineReadable ? stderr : output;
+    ProgramPool pool;
+    initializeProgramPool(&pool, residentPrograms, diagnostics);
+    INSTRUMENTATION_RESET();
+    TaskDescriptor *tasksDescriptions = table.descriptors;
+    for (int i = 0; i < numberOfTasks; i++) {
+        initializeTaskDescriptor(&tasksDescriptions[i], &table.tasks[i], &table.memories[i], taskList->names[i]);
+        tasksDescriptions[i].priority = taskList->priorities[i];
+        INSTRUMENTATION_START(validationStart);
+        boolean valid = validateFile(taskList->names[i], &tasksDescriptions[i].task->program, diagnostics);
+        INSTRUMENTATION_STOP(validationStart, TIMER_VALIDATE_FILE);
+        if (!valid || !initializeTaskVariables(&tasksDescriptions[i])) {
+            fprintf(diagnostics, DIVERGET_INSTRUCTION_ERROR, taskList->names[i]);
+            tasksDescriptions[i].aborted = TRUE;
+            tasksDescriptions[i].status = FINISHED;
+        }
+        tasksDescriptions[i].numberOfInstructions = table.tasks[i].program.numberOfInstructions;
+        if (!tasksDescriptions[i].aborted) {
+            admitTaskProgram(&pool, &table.tasks[i]);
+        }
+    }
+    EventTrace trace;
+    EventTrace *tracePtr = NULL;
+    if (traceFile != NULL) {
+        if (!openEventTrace(&trace, traceFile, policy, replacement, machine, numberOfCores, tasksDescriptions, numberOfTasks)) {
+            fprintf(diagnostics, TRACE_ERROR, traceFile->fileName);
+            freeTaskTable(&table);
+            return EXIT_FAILURE;
+        }
+        tracePtr = &trace;
+    }
+    if (checkpoint != NULL) {
+        checkpoint->pool = &pool;
+        checkpoint->output = diagnostics;
+    }
+    RoundRobin roundRobin = scheduleTasks(tasksDescriptions, numberOfTasks, policy, replacement, tlb, machine, numberOfCores, tracePtr, checkpoint, diagnostics);
+    if (tracePtr != NULL) {
+        closeEventTrace(tracePtr);
+    }
+    if (checkpoint != NULL && checkpoint->restoreFailed) {
+        freeTaskTable(&table);
+        return EXIT_FAILURE;
+    }
+    roundRobin.residentProgramLimit = pool.capacity;
+    roundRobin.peakResidentPrograms = pool.peakResidentPrograms;
+    roundRobin.programReloads = pool.reloads;
+    INSTRUMENTATION_START(reportStart);
+    reportFormat->printReport(output, &roundRobin, tasksDescriptions, numberOfTasks);
+    INSTRUMENTATION_STOP(reportStart, TIMER_PRINT_REPORT);
+    INSTRUMENTATION_PRINT(diagnostics);
+
+    freeTaskTable(&table);
+    return checkpoint != NULL && checkpoint->saveFailed ? EXIT_FAILURE : EXIT_SUCCESS;
+}//runSimulation()
+
+/* Lê um valor numérico da geometria de memória ou do quantum.
+   Parâmetros:
+   - text: Valor informado.
+   - minimum: Menor valor aceito.
+   - maximum: Maior valor aceito.
+   - value: Recebe o valor lido.
+   Retorno:
+   - TRUE se o valor é um número dentro dos limites, FALSE caso contrário.
+*/
+boolean parseMachineValue(const char *text, unsigned int minimum, unsigned int maximum, unsigned int *value) {
+    char *end;
+    unsigned long number = strtoul(text, &end, 10);
+    if (!isdigit((unsigned char)*text) || *end != NULL_CHAR || number < minimum || number > maximum) {
+        return FALSE;
+    }
+    *value = (unsigned int) number;
+    return TRUE;
+}//parseMachineValue()
+
+/* Lê a lista de tamanhos de página, separada por vírgulas, substituindo a lista anterior do cenário.
+   Parâmetros:
+   - scenario: Cenário que recebe os tamanhos de página.
+   - text: Lista de tamanhos de página, em bytes.
+   Retorno:
+   - TRUE se todos os tamanhos são números válidos, FALSE caso contrário.
+*/
+boolean parsePageSizes(Scenario* scenario, const char *text) {
+    char value[STRING_DEFAULT_SIZE];
+    scenario->numberOfPageSizes = 0;
+    while (TRUE) {
+        size_t length = strcspn(text, POLICY_LIST_SEPARATOR);
+        if (length >= STRING_DEFAULT_SIZE || scenario->numberOfPageSizes == MAXIMUM_NUMBER_OF_PAGE_SIZES) {
+            return FALSE;
+        }
+        memcpy(value, text, length);
+        value[length] = NULL_CHAR;
+        if (!parseMachineValue(value, MINIMUM_PAGE_SIZE, MAXIMUM_MEMORY_SIZE, &scenario->pageSizes[scenario->numberOfPageSizes])) {
+            return FALSE;
+        }
+        scenario->numberOfPageSizes++;
+        if (text[length] == NULL_CHAR) {
+            return TRUE;
+        }
+        text += length + 1;
+    }
+}//parsePageSizes()
+
+/* Lê a geometria de memória e o quantum de um arquivo de configuração.
+   Cada linha contém uma chave (pagina, memoria_fisica, memoria_logica ou quantum) seguida do valor;
+   a chave pagina aceita uma lista de tamanhos separada por vírgulas. Linhas vazias e iniciadas por '#'
+   são ignoradas, e as opções seguintes da linha de comando sobrescrevem os valores lidos.
+   Parâmetros:
+   - scenario: Cenário que recebe a configuração.
+   - configurationName: Caminho do arquivo de configuração.
+   - output: Saída das mensagens de erro.
+   Retorno:
+   - TRUE se o arquivo foi lido, FALSE caso contrário.
+*/
+boolean loadMachineConfiguration(Scenario* scenario, const char *configurationName, FILE *output) {
+    FILE *configuration = fopen(configurationName, "r");
+    if (configuration == NULL) {
+        fprintf(output, CONFIGURATION_OPEN_ERROR, configurationName);
+        return FALSE;
+    }
+
+    char *line = NULL;
+    size_t lineCapacity = 0;
+    ssize_t length;
+    boolean loaded = TRUE;
+
+    while (loaded && (length = getline(&line, &lineCapacity, configuration)) != -1) {
+        char *start = line;
+        char *end = line + length;
+        while (start < end && isspace((unsigned char)*start)) {
+            start++;
+        }
+        while (end > start && isspace((unsigned char)end[-1])) {
+            end--;
+        }
+        *end = NULL_CHAR;
+        if (start == end || *start == '#') {
+            continue;
+        }
+
+        // Chave e valor separados por espaços.
+        char *keyEnd = start;
+        while (keyEnd < end && !isspace((unsigned char)*keyEnd)) {
+            keyEnd++;
+        }
+        char *value = keyEnd;
+        while (value < end && isspace((unsigned char)*value)) {
+            value++;
+        }
+        size_t keyLength = keyEnd - start;
+        if (keyLength == strlen(CONFIGURATION_PAGE_SIZE) && strncmp(start, CONFIGURATION_PAGE_SIZE, keyLength) == 0) {
+            loaded = parsePageSizes(scenario, value);
+        }
+        else if (keyLength == strlen(CONFIGURATION_PHYSICAL_MEMORY) && strncmp(start, CONFIGURATION_PHYSICAL_MEMORY, keyLength) == 0) {
+            loaded = parseMachineValue(value, MINIMUM_PAGE_SIZE, MAXIMUM_MEMORY_SIZE, &scenario->machine.physicalMemorySize);
+        }
+        else if (keyLength == strlen(CONFIGURATION_LOGICAL_MEMORY) && strncmp(start, CONFIGURATION_LOGICAL_MEMORY, keyLength) == 0) {
+            loaded = parseMachineValue(value, 1, MAXIMUM_MEMORY_SIZE, &scenario->machine.logicalMemorySize);
+        }
+        else if (keyLength == strlen(CONFIGURATION_QUANTUM) && strncmp(start, CONFIGURATION_QUANTUM, keyLength) == 0) {
+            loaded = parseMachineValue(value, 1, MAXIMUM_QUANTUM, &scenario->machine.quantum);
+        }
+        else {
+            loaded = FALSE;
+        }
+        if (!loaded) {
+            fprintf(output, CONFIGURATION_LINE_ERROR, configurationName, start);
+        }
+    }
+    free(line);
+    fclose(configuration);
+    return loaded;
+}//loadMachineConfiguration()
+
+/* Lê a opção -k: o instante, opcional, e o arquivo em que o estado da simulação é salvo.
+   Sem o instante, o estado é salvo apenas quando o processo recebe o sinal CHECKPOINT_SIGNAL, que o modo em lote ignora.
+   Parâmetros:
+   - scenario: Cenário que recebe o arquivo e o instante.
+   - text: Valor informado, no formato [instante:]arquivo.
+   Retorno:
+   - TRUE se o valor é válido, FALSE caso contrário.
+*/
+boolean parseCheckpoint(Scenario* scenario, const char *text) {
+    const char *fileName = text;
+    scenario->checkpointTime = NO_CHECKPOINT_TIME;
+    if (isdigit((unsigned char) *text)) {
+        char *end;
+        errno = 0;
+        unsigned long time = strtoul(text, &end, 10);
+        if (*end == CHECKPOINT_TIME_SEPARATOR) {
+            if (errno != 0 || time >= NO_CHECKPOINT_TIME) {
                 return FALSE;
-            } else {
-                taskDescriptor->accesses[taskDescriptor->quantityAccesses] = taskDescriptor->variable[i];
-                taskDescriptor->accesses[taskDescriptor->quantityAccesses++].value = value;
-                return TRUE;
             }
+            scenario->checkpointTime = (TimeUnit) time;
+            fileName = end + 1;
         }
     }
-    printf(UNDECLARED_IDENTIFIER_ERROR, taskDescriptor->task.nameOfTask, identifier);
-    finishTask(taskDescriptor, TRUE, roundRobin);
-    return FALSE;
-}//memoryAccess()
+    if (*fileName == NULL_CHAR) {
+        return FALSE;
+    }
+    free(scenario->checkpointFileName);
+    scenario->checkpointFileName = strdup(fileName);
+    return scenario->checkpointFileName != NULL;
+}//parseCheckpoint()
 
-/* Finaliza uma tarefa.
-   Esta função atualiza o status de uma tarefa para finalizada e configura a marca de abortada, se aplicável.
-   Atualiza também o tempo de término, fecha o arquivo associado à tarefa e ajusta as métricas globais do sistema.
+/* Lê as opções e os nomes de tarefa de um cenário.
+   As opções são as mesmas da linha de comando. Em caso de erro, a mensagem e o uso do programa são escritos
+   na saída informada e o cenário é marcado como falho, sem encerrar o processo.
    Parâmetros:
-   - taskDescriptor: Ponteiro para o descritor da tarefa (TaskDescriptor).
-   - aborted: Indica se a tarefa foi abortada (TRUE) ou concluída com sucesso (FALSE).
-   - roundRobin: Ponteiro para a estrutura RoundRobin contendo informações do sistema.
+   - scenario: Cenário a ser preenchido, zerado; um formato de relatório já definido é usado como padrão do -o.
+   - numberOfArguments: Número de argumentos.
+   - arguments: Argumentos (o primeiro é o nome do programa).
+   - output: Saída das mensagens de erro.
+   Retorno:
+   - EXIT_SUCCESS se o cenário é válido, EXIT_FAILURE caso contrário.
 */
-void finishTask(TaskDescriptor* taskDescriptor, boolean aborted, RoundRobin* roundRobin) {
-    taskDescriptor->aborted = aborted;
-    taskDescriptor->status = FINISHED;
-    taskDescriptor->endTime = roundRobin->totalCPUClocks;
-    fclose(taskDescriptor->task.taskFile);
-    if (aborted) {
-        roundRobin->totalCPUClocks -= taskDescriptor->cpuTime;
-        roundRobin->totalOutputTime -= taskDescriptor->inputOutputTime;
+int parseScenario(Scenario* scenario, int numberOfArguments, char *arguments[], FILE *output) {
+    boolean validArguments = TRUE;
+    const char *policies = DEFAULT_SCHEDULING_POLICY;
+    const char *replacements = NULL;
+    int option;
+
+    scenario->numberOfCores = DEFAULT_NUMBER_OF_CORES;
+    scenario->residentPrograms = DEFAULT_RESIDENT_PROGRAMS;
+    scenario->machine.pageSize = DEFAULT_PAGE_SIZE;
+    scenario->machine.physicalMemorySize = DEFAULT_PHYSICAL_MEMORY_SIZE;
+    scenario->machine.logicalMemorySize = DEFAULT_LOGICAL_MEMORY_SIZE;
+    scenario->machine.quantum = DEFAULT_QUANTUM;
+    if (scenario->reportFormat == NULL) {
+        scenario->reportFormat = findReportFormat(DEFAULT_REPORT_FORMAT);
+    }
+    scenario->result = EXIT_FAILURE;
+
+    // Reinicia o getopt, pois cada cenário do modo em lote é lido com um novo vetor de argumentos.
+    optind = 0;
+    while (validArguments && (option = getopt(numberOfArguments, arguments, "p:r:t:s:M:L:q:f:c:P:T:k:R:o:m:g:b:j:")) != -1) {
+        switch (option) {
+            case 'p':
+                policies = optarg;
+                break;
+            case 'r':
+                replacements = optarg;
+                break;
+            case 't':
+                if (!parseTlbConfiguration(optarg, &scenario->tlb)) {
+                    fprintf(output, INVALID_TLB_ERROR, optarg, MAXIMUM_TLB_ENTRIES);
+                    fprintf(output, USAGE_MESSAGE, arguments[0], arguments[0]);
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 's':
+                if (!parsePageSizes(scenario, optarg)) {
+                    fprintf(output, INVALID_MACHINE_VALUE_ERROR, "-s", optarg);
+                    fprintf(output, USAGE_MESSAGE, arguments[0], arguments[0]);
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 'M':
+                if (!parseMachineValue(optarg, MINIMUM_PAGE_SIZE, MAXIMUM_MEMORY_SIZE, &scenario->machine.physicalMemorySize)) {
+                    fprintf(output, INVALID_MACHINE_VALUE_ERROR, "-M", optarg);
+                    fprintf(output, USAGE_MESSAGE, arguments[0], arguments[0]);
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 'L':
+                if (!parseMachineValue(optarg, 1, MAXIMUM_MEMORY_SIZE, &scenario->machine.logicalMemorySize)) {
+                    fprintf(output, INVALID_MACHINE_VALUE_ERROR, "-L", optarg);
+                    fprintf(output, USAGE_MESSAGE, arguments[0], arguments[0]);
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 'q':
+                if (!parseMachineValue(optarg, 1, MAXIMUM_QUANTUM, &scenario->machine.quantum)) {
+                    fprintf(output, INVALID_MACHINE_VALUE_ERROR, "-q", optarg);
+                    fprintf(output, USAGE_MESSAGE, arguments[0], arguments[0]);
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 'f':
+                validArguments = loadMachineConfiguration(scenario, optarg, output);
+                break;
+            case 'c': {
+                char *end;
+                long cores = strtol(optarg, &end, 10);
+                if (*optarg == NULL_CHAR || *end != NULL_CHAR || cores < 1 || cores > MAXIMUM_NUMBER_OF_CORES) {
+                    fprintf(output, INVALID_CORES_ERROR, optarg, MAXIMUM_NUMBER_OF_CORES);
+                    fprintf(output, USAGE_MESSAGE, arguments[0], arguments[0]);
+                    return EXIT_FAILURE;
+                }
+                scenario->numberOfCores = (unsigned int) cores;
+                break;
+            }
+            case 'P':
+                if (!parseMachineValue(optarg, 1, UINT_MAX, &scenario->residentPrograms)) {
+                    fprintf(output, INVALID_RESIDENT_PROGRAMS_ERROR, optarg);
+                    fprintf(output, USAGE_MESSAGE, arguments[0], arguments[0]);
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 'T':
+                free(scenario->traceFileName);
+                scenario->traceFileName = strdup(optarg);
+                validArguments = scenario->traceFileName != NULL;
+                break;
+            case 'k':
+                if (!parseCheckpoint(scenario, optarg)) {
+                    fprintf(output, INVALID_CHECKPOINT_ERROR, optarg);
+                    fprintf(output, USAGE_MESSAGE, arguments[0], arguments[0]);
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 'R':
+                free(scenario->restoreFileName);
+                scenario->restoreFileName = strdup(optarg);
+                validArguments = scenario->restoreFileName != NULL;
+                break;
+            case 'o':
+                scenario->reportFormat = findReportFormat(optarg);
+                if (scenario->reportFormat == NULL) {
+                    fprintf(output, UNKNOWN_REPORT_FORMAT_ERROR, optarg);
+                    fprintf(output, USAGE_MESSAGE, arguments[0], arguments[0]);
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 'm':
+                validArguments = loadTaskManifest(&scenario->taskList, optarg, output);
+                break;
+            case 'g':
+                validArguments = loadTaskGlob(&scenario->taskList, optarg);
+                break;
+            case 'b':
+                scenario->batchFileName = optarg;
+                break;
+            case 'j': {
+                char *end;
+                long threads = strtol(optarg, &end, 10);
+                if (*optarg == NULL_CHAR || *end != NULL_CHAR || threads < 1 || threads > INT_MAX) {
+                    fprintf(output, INVALID_THREADS_ERROR, optarg);
+                    fprintf(output, USAGE_MESSAGE, arguments[0], arguments[0]);
+                    return EXIT_FAILURE;
+                }
+                scenario->numberOfThreads = (int) threads;
+                break;
+            }
+            default:
+                validArguments = FALSE;
+                break;
+        }
     }
-    int number = taskDescriptor->endTime - taskDescriptor->cpuTime - taskDescriptor->startTime;
-    if(number > 0){
-        roundRobin->waitTime += taskDescriptor->endTime - taskDescriptor->cpuTime - taskDescriptor->startTime;
+    for (int i = optind; validArguments && i < numberOfArguments; i++) {
+        validArguments = addTaskName(&scenario->taskList, arguments[i], strlen(arguments[i]), 0);
     }
-}//finishTask()
 
-/* Verifica e atualiza as tarefas suspensas.
-   Esta função percorre a lista de tarefas e verifica se alguma está suspensa.
-   Se uma tarefa estiver suspensa, ela decrementa o tempo de suspensão pelo número de unidades de tempo especificado.
-   Se o tempo de suspensão chegar a zero, a função atualiza o status da tarefa para READY e a coloca na fila de tarefas prontas.
+    // No modo em lote as tarefas vêm dos cenários.
+    if (scenario->batchFileName != NULL) {
+        if (!validArguments || scenario->taskList.numberOfTasks > 0) {
+            fprintf(output, INVALID_ARGUMENTS_ERROR);
+            fprintf(output, USAGE_MESSAGE, arguments[0], arguments[0]);
+            return EXIT_FAILURE;
+        }
+        scenario->result = EXIT_SUCCESS;
+        return EXIT_SUCCESS;
+    }
+
+    if (!validArguments || !validateNumberOfArguments(scenario->taskList.numberOfTasks)) {
+        fprintf(output, INVALID_ARGUMENTS_ERROR);
+        fprintf(output, USAGE_MESSAGE, arguments[0], arguments[0]);
+        return EXIT_FAILURE;
+    }
+
+    // Valida todas as políticas antes de iniciar a primeira simulação.
+    const char *policyName = policies;
+    while (TRUE) {
+        size_t length = strcspn(policyName, POLICY_LIST_SEPARATOR);
+        const SchedulingPolicy* policy = findSchedulingPolicy(policyName, length);
+        if (policy == NULL || scenario->numberOfPolicies == NUMBER_OF_SCHEDULING_POLICIES) {
+            fprintf(output, UNKNOWN_POLICY_ERROR, policyName);
+            fprintf(output, USAGE_MESSAGE, arguments[0], arguments[0]);
+            return EXIT_FAILURE;
+        }
+        scenario->policies[scenario->numberOfPolicies++] = policy;
+        if (policyName[length] == NULL_CHAR) {
+            break;
+        }
+        policyName += length + 1;
+    }
+
+    // A paginação sob demanda só é usada quando alguma política de substituição é informada.
+    const char *replacementName = replacements;
+    while (replacementName != NULL) {
+        size_t length = strcspn(replacementName, POLICY_LIST_SEPARATOR);
+        const ReplacementPolicy* replacement = findReplacementPolicy(replacementName, length);
+        if (replacement == NULL || scenario->numberOfReplacements == NUMBER_OF_REPLACEMENT_POLICIES) {
+            fprintf(output, UNKNOWN_REPLACEMENT_ERROR, replacementName);
+            fprintf(output, USAGE_MESSAGE, arguments[0], arguments[0]);
+            return EXIT_FAILURE;
+        }
+        scenario->replacements[scenario->numberOfReplacements++] = replacement;
+        replacementName = replacementName[length] == NULL_CHAR ? NULL : replacementName + length + 1;
+    }
+
+    // Sem -s, a simulação usa o tamanho de página da configuração; todas as geometrias são validadas antes da primeira simulação.
+    if (scenario->numberOfPageSizes == 0) {
+        scenario->pageSizes[scenario->numberOfPageSizes++] = scenario->machine.pageSize;
+    }
+    for (int i = 0; i < scenario->numberOfPageSizes; i++) {
+        MachineConfiguration machine = scenario->machine;
+        machine.pageSize = scenario->pageSizes[i];
+        if (!configureMachine(&machine)) {
+            fprintf(output, INVALID_MACHINE_ERROR, machine.pageSize, machine.physicalMemorySize, machine.logicalMemorySize,
+                machine.maximumNumberOfPages, MAXIMUM_NUMBER_OF_FRAMES);
+            fprintf(output, USAGE_MESSAGE, arguments[0], arguments[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    // O estado salvo pertence a uma única simulação.
+    int numberOfSimulations = scenario->numberOfPolicies * (scenario->numberOfReplacements > 0 ? scenario->numberOfReplacements : 1) * scenario->numberOfPageSizes;
+    if ((scenario->checkpointFileName != NULL || scenario->restoreFileName != NULL) && numberOfSimulations > 1) {
+        fprintf(output, CHECKPOINT_SIMULATIONS_ERROR);
+        fprintf(output, USAGE_MESSAGE, arguments[0], arguments[0]);
+        return EXIT_FAILURE;
+    }
+
+    scenario->result = EXIT_SUCCESS;
+    return EXIT_SUCCESS;
+}//parseScenario()
+
+/* Executa as simulações de um cenário, uma por tamanho de página e por política de escalonamento e de
+   substituição de páginas, e escreve os relatórios na saída informada.
+   Parâmetros:
+   - scenario: Cenário válido.
+   - output: Saída dos relatórios.
+   Retorno:
+   - EXIT_SUCCESS se a execução for bem-sucedida, EXIT_FAILURE caso contrário.
+*/
+int runScenario(Scenario* scenario, FILE *output) {
+    TraceFile *trace = NULL;
+    if (scenario->traceFileName != NULL) {
+        if (!openTraceFile(&scenario->trace, scenario->traceFileName, scenario->reportFormat->machineReadable ? stderr : output)) {
+            return EXIT_FAILURE;
+        }
+        trace = &scenario->trace;
+    }
+
+    Checkpoint checkpoint;
+    Checkpoint *checkpointPtr = NULL;
+    if (scenario->checkpointFileName != NULL || scenario->restoreFileName != NULL) {
+        memset(&checkpoint, 0, sizeof(Checkpoint));
+        checkpoint.saveFileName = scenario->checkpointFileName;
+        checkpoint.saveTime = scenario->checkpointTime;
+        checkpoint.followsSignal = scenario->description == NULL;
+        checkpoint.restoreFileName = scenario->restoreFileName;
+        checkpointPtr = &checkpoint;
+    }
+    if (scenario->checkpointFileName != NULL && scenario->description == NULL) {
+        struct sigaction action;
+        memset(&action, 0, sizeof(action));
+        action.sa_handler = requestCheckpoint;
+        sigemptyset(&action.sa_mask);
+        action.sa_flags = SA_RESTART;
+        sigaction(CHECKPOINT_SIGNAL, &action, NULL);
+    }
+
+    int result = EXIT_SUCCESS;
+    for (int k = 0; k < scenario->numberOfPageSizes && result == EXIT_SUCCESS; k++) {
+        MachineConfiguration machine = scenario->machine;
+        machine.pageSize = scenario->pageSizes[k];
+        configureMachine(&machine);
+        for (int i = 0; i < scenario->numberOfPolicies && result == EXIT_SUCCESS; i++) {
+            if (scenario->numberOfReplacements == 0) {
+                result = runSimulation(&scenario->taskList, scenario->policies[i], NULL, &scenario->tlb, &machine, scenario->numberOfCores, scenario->residentPrograms, trace, checkpointPtr, scenario->reportFormat, output);
+            }
+            for (int j = 0; j < scenario->numberOfReplacements && result == EXIT_SUCCESS; j++) {
+                result = runSimulation(&scenario->taskList, scenario->policies[i], scenario->replacements[j], &scenario->tlb, &machine, scenario->numberOfCores, scenario->residentPrograms, trace, checkpointPtr, scenario->reportFormat, output);
+            }
+        }
+    }
+    if (trace != NULL && !closeTraceFile(trace, scenario->reportFormat->machineReadable ? stderr : output)) {
+        result = EXIT_FAILURE;
+    }
+    return result;
+}//runScenario()
+
+/* Libera a memória de um cenário.
+   Parâmetros:
+   - scenario: Cenário a ser liberado.
+*/
+void freeScenario(Scenario* scenario) {
+    freeTaskList(&scenario->taskList);
+    free(scenario->description);
+    free(scenario->traceFileName);
+    free(scenario->checkpointFileName);
+    free(scenario->restoreFileName);
+    if (scenario->output != NULL) {
+        fclose(scenario->output);
+    }
+    free(scenario->report);
+    memset(scenario, 0, sizeof(Scenario));
+}//freeScenario()
+
+/* Divide uma linha da lista de cenários em argumentos separados por espaços.
+   A linha é modificada no lugar: os separadores são substituídos por caracteres nulos.
+   Parâmetros:
+   - line: Linha a ser dividida.
+   - programName: Nome do programa, usado como primeiro argumento.
+   - numberOfArguments: Recebe o número de argumentos.
+   Retorno:
+   - Vetor de argumentos alocado no heap (terminado em NULL), ou NULL se não houver memória disponível.
+*/
+char** splitScenarioArguments(char *line, const char *programName, int *numberOfArguments) {
+    int capacity = 2;
+    for (const char *cursor = line; *cursor != NULL_CHAR; cursor++) {
+        if (isspace((unsigned char)*cursor)) {
+            capacity++;
+        }
+    }
+    char **arguments = (char**)malloc((capacity + 1) * sizeof(char*));
+    if (arguments == NULL) {
+        return NULL;
+    }
+
+    int count = 0;
+    arguments[count++] = (char*)programName;
+    char *cursor = line;
+    while (*cursor != NULL_CHAR) {
+        while (isspace((unsigned char)*cursor)) {
+            *cursor++ = NULL_CHAR;
+        }
+        if (*cursor == NULL_CHAR) {
+            break;
+        }
+        arguments[count++] = cursor;
+        while (*cursor != NULL_CHAR && !isspace((unsigned char)*cursor)) {
+            cursor++;
+        }
+    }
+    arguments[count] = NULL;
+    *numberOfArguments = count;
+    return arguments;
+}//splitScenarioArguments()
+
+/* Lê a lista de cenários do modo em lote.
+   Cada linha contém as opções e tarefas de um cenário, como na linha de comando; linhas vazias e iniciadas
+   por '#' são ignoradas. Os cenários são lidos na thread principal (o getopt não é reentrante), e o relatório
+   de cada um, inclusive os erros de leitura, é acumulado em memória.
+   Parâmetros:
+   - batchFileName: Caminho da lista de cenários.
+   - programName: Nome do programa, usado nas mensagens de uso.
+   - reportFormat: Formato de relatório dos cenários que não informam -o.
+   - numberOfScenarios: Recebe o número de cenários lidos.
+   Retorno:
+   - Vetor de cenários alocado no heap, ou NULL em caso de erro.
+*/
+Scenario* loadScenarios(const char *batchFileName, const char *programName, const ReportFormat* reportFormat, int *numberOfScenarios) {
+    FILE *batchFile = fopen(batchFileName, "r");
+    if (batchFile == NULL) {
+        printf(BATCH_OPEN_ERROR, batchFileName);
+        return NULL;
+    }
+
+    Scenario *scenarios = NULL;
+    int count = 0;
+    int capacity = 0;
+    boolean loaded = TRUE;
+    char *line = NULL;
+    size_t lineCapacity = 0;
+    ssize_t length;
+
+    while (loaded && (length = getline(&line, &lineCapacity, batchFile)) != -1) {
+        while (length > 0 && isspace((unsigned char)line[length - 1])) {
+            line[--length] = NULL_CHAR;
+        }
+        const char *start = line;
+        while (isspace((unsigned char)*start)) {
+            start++;
+        }
+        if (*start == NULL_CHAR || *start == '#') {
+            continue;
+        }
+
+        if (count == capacity) {
+            capacity = capacity == 0 ? INITIAL_TASK_LIST_CAPACITY : capacity * 2;
+            Scenario *grown = (Scenario*)realloc(scenarios, capacity * sizeof(Scenario));
+            if (grown == NULL) {
+                loaded = FALSE;
+                break;
+            }
+            scenarios = grown;
+        }
+        Scenario *scenario = &scenarios[count++];
+        memset(scenario, 0, sizeof(Scenario));
+        scenario->reportFormat = reportFormat;
+        scenario->description = strdup(start);
+        scenario->output = open_memstream(&scenario->report, &scenario->reportSize);
+        char *argumentsLine = strdup(start);
+        int numberOfArguments = 0;
+        char **arguments = argumentsLine != NULL ? splitScenarioArguments(argumentsLine, programName, &numberOfArguments) : NULL;
+        if (scenario->description == NULL || scenario->output == NULL || arguments == NULL) {
+            loaded = FALSE;
+        }
+        else if (parseScenario(scenario, numberOfArguments, arguments, scenario->output) == EXIT_SUCCESS && scenario->batchFileName != NULL) {
+            // Um cenário não pode abrir outra lista de cenários.
+            fprintf(scenario->output, INVALID_ARGUMENTS_ERROR);
+            scenario->result = EXIT_FAILURE;
+        }
+        free(arguments);
+        free(argumentsLine);
+    }
+    free(line);
+    fclose(batchFile);
+
+    if (!loaded) {
+        printf(BATCH_OUTPUT_ERROR);
+        for (int i = 0; i < count; i++) {
+            freeScenario(&scenarios[i]);
+        }
+        free(scenarios);
+        return NULL;
+    }
+    *numberOfScenarios = count;
+    return scenarios;
+}//loadScenarios()
+
+/* Laço de uma thread do modo em lote: retira cenários da fila compartilhada e os executa até a fila esvaziar.
+   Cada cenário escreve apenas no seu próprio relatório em memória.
+   Parâmetros:
+   - argument: Ponteiro para a fila de cenários (ScenarioQueue).
+   Retorno:
+   - NULL.
+*/
+void* runScenarioWorker(void *argument) {
+    ScenarioQueue *queue = (ScenarioQueue*)argument;
+    if (queue->locale != (locale_t) 0) {
+        uselocale(queue->locale);
+    }
+
+    while (TRUE) {
+        pthread_mutex_lock(&queue->lock);
+        int index = queue->next < queue->numberOfScenarios ? queue->next++ : -1;
+        pthread_mutex_unlock(&queue->lock);
+        if (index < 0) {
+            break;
+        }
+
+        Scenario *scenario = &queue->scenarios[index];
+        if (scenario->result == EXIT_SUCCESS) {
+            scenario->result = runScenario(scenario, scenario->output);
+        }
+        fflush(scenario->output);
+    }
+    return NULL;
+}//runScenarioWorker()
+
+/* Executa os cenários de uma lista em paralelo e imprime os relatórios na ordem da lista.
+   As simulações são distribuídas entre um conjunto de threads (por padrão, uma por núcleo do computador);
+   a thread principal também executa cenários. Cada relatório é acumulado em memória e impresso inteiro,
+   após o término de todas as threads, de forma que a saída dos cenários não se intercala. Cada relatório é precedido
+   da identificação do cenário no seu formato, e o cabeçalho de cada formato é impresso antes do primeiro relatório.
+   Parâmetros:
+   - batchFileName: Caminho da lista de cenários.
+   - programName: Nome do programa.
+   - numberOfThreads: Número de threads, ou 0 para usar o número de núcleos do computador.
+   - locale: Região usada pelas threads.
+   - reportFormat: Formato de relatório dos cenários que não informam -o.
+   Retorno:
+   - EXIT_SUCCESS se todos os cenários foram executados com sucesso, EXIT_FAILURE caso contrário.
+*/
+int runBatch(const char *batchFileName, const char *programName, int numberOfThreads, locale_t locale, const ReportFormat* reportFormat) {
+    ScenarioQueue queue;
+    queue.numberOfScenarios = 0;
+    queue.scenarios = loadScenarios(batchFileName, programName, reportFormat, &queue.numberOfScenarios);
+    if (queue.scenarios == NULL) {
+        return EXIT_FAILURE;
+    }
+    queue.next = 0;
+    queue.locale = locale;
+    pthread_mutex_init(&queue.lock, NULL);
+
+    if (numberOfThreads <= 0) {
+        long processors = sysconf(_SC_NPROCESSORS_ONLN);
+        numberOfThreads = processors > 0 ? (int) processors : 1;
+    }
+    if (numberOfThreads > queue.numberOfScenarios) {
+        numberOfThreads = queue.numberOfScenarios > 0 ? queue.numberOfScenarios : 1;
+    }
+
+    // Threads que não puderem ser criadas são compensadas pela thread principal, que também consome a fila.
+    pthread_t *threads = (pthread_t*)malloc(numberOfThreads * sizeof(pthread_t));
+    int startedThreads = 0;
+    for (int i = 1; threads != NULL && i < numberOfThreads; i++) {
+        if (pthread_create(&threads[startedThreads], NULL, runScenarioWorker, &queue) == 0) {
+            startedThreads++;
+        }
+    }
+    runScenarioWorker(&queue);
+    for (int i = 0; i < startedThreads; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    free(threads);
+    pthread_mutex_destroy(&queue.lock);
+
+    int result = EXIT_SUCCESS;
+    boolean headerPrinted[NUMBER_OF_REPORT_FORMATS] = {FALSE};
+    for (int i = 0; i < queue.numberOfScenarios; i++) {
+        Scenario *scenario = &queue.scenarios[i];
+        fclose(scenario->output);
+        scenario->output = NULL;
+        const ReportFormat* format = scenario->reportFormat;
+        if (format->printHeader != NULL && !headerPrinted[format - REPORT_FORMATS]) {
+            format->printHeader(stdout);
+            headerPrinted[format - REPORT_FORMATS] = TRUE;
+        }
+        if (format->printScenarioHeader != NULL) {
+            format->printScenarioHeader(stdout, i + 1, scenario->description);
+        }
+        fwrite(scenario->report, 1, scenario->reportSize, stdout);
+        if (scenario->result != EXIT_SUCCESS) {
+            result = EXIT_FAILURE;
+        }
+        freeScenario(scenario);
+    }
+    free(queue.scenarios);
+    return result;
+}//runBatch()
+
+/* Compilador de tarefas (tsmm-compile): decodifica cada arquivo de tarefa e grava o programa no formato .tskb,
+   ao lado do arquivo original, para que o simulador carregue a tarefa sem analisar o texto.
+   Parâmetros:
+   - numberOfArguments: Número de argumentos do programa.
+   - arguments: Argumentos do programa (nomes dos arquivos de tarefa, com ou sem a extensão FILE_EXTENSION).
+   Retorno:
+   - EXIT_SUCCESS se todas as tarefas foram compiladas, EXIT_FAILURE caso contrário.
+*/
+int tsmmCompile(int numberOfArguments, char *arguments[]) {
+    if (numberOfArguments < 2) {
+        fprintf(stderr, COMPILER_USAGE_MESSAGE, arguments[0]);
+        return EXIT_FAILURE;
+    }
+
+    int result = EXIT_SUCCESS;
+    size_t extensionLength = strlen(FILE_EXTENSION);
+    for (int i = 1; i < numberOfArguments; i++) {
+        FileName taskName;
+        size_t length = strlen(arguments[i]);
+        if (length > extensionLength && strcmp(arguments[i] + length - extensionLength, FILE_EXTENSION) == 0) {
+            length -= extensionLength;
+        }
+        if (length + strlen(COMPILED_FILE_EXTENSION) >= FILE_NAME_SIZE) {
+            fprintf(stderr, FILE_OPEN_ERROR, arguments[i]);
+            result = EXIT_FAILURE;
+            continue;
+        }
+        memcpy(taskName, arguments[i], length);
+        taskName[length] = NULL_CHAR;
+
+        TaskProgram program;
+        memset(&program, 0, sizeof(TaskProgram));
+        if (!validateFile(taskName, &program, stderr)) {
+            fprintf(stderr, DIVERGET_INSTRUCTION_ERROR, taskName);
+            result = EXIT_FAILURE;
+            continue;
+        }
+        FileName compiledName;
+        memcpy(compiledName, taskName, length);
+        strcpy(compiledName + length, COMPILED_FILE_EXTENSION);
+        if (!writeCompiledTask(compiledName, &program)) {
+            fprintf(stderr, COMPILED_FILE_WRITE_ERROR, compiledName);
+            result = EXIT_FAILURE;
+        }
+        freeTaskProgram(&program);
+    }
+    if (result != EXIT_SUCCESS) {
+        fputc('\n', stderr);
+    }
+    return result;
+}//tsmmCompile()
+
+/* Gera o próximo número pseudoaleatório de uma carga de trabalho sintética (SplitMix64).
+   O gerador não depende de rand(), de forma que a mesma semente gera a mesma carga em qualquer plataforma.
    Parâmetros:
-   - queue: Ponteiro para a fila de descritores de tarefas (TaskDescriptorQueue).
-   - tasks: Array de descritores de tarefas (TaskDescriptor).
-   - numberOfTasks: Número total de tarefas no array.
-   - timeUnits: Unidades de tempo a serem subtraídas do tempo de suspensão das tarefas.
+   - state: Estado do gerador, avançado a cada chamada.
+   Retorno:
+   - Número pseudoaleatório de 64 bits.
 */
-void checkAndUpdateSuspendedTasks(TaskDescriptorQueue* queue, TaskDescriptor tasks[], int numberOfTasks, unsigned timeUnits) {
-    for (int i = 0; i < numberOfTasks; i++) {
-        if (tasks[i].status == SUSPENDED) {
-            tasks[i].suspendedTime -= timeUnits;
-            if (tasks[i].suspendedTime == 0) {
-                tasks[i].status = READY;
-                enqueueTaskDescriptor(queue, &tasks[i]);
-            }
-        }
-    }
-}//checkAndUpdateSuspendedTasks()
+uint64_t nextWorkloadRandom(uint64_t *state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}//nextWorkloadRandom()
 
-/* Arredonda um número float para o inteiro mais próximo.
-   Esta função recebe um número em ponto flutuante e retorna o valor arredondado para o inteiro mais próximo.
+/* Sorteia um número entre 0 e bound - 1.
    Parâmetros:
-   - number: Número em ponto flutuante a ser arredondado.
+   - state: Estado do gerador.
+   - bound: Limite superior (exclusivo), maior que 0.
    Retorno:
-   - Valor arredondado para o inteiro mais próximo (int).
+   - Número sorteado.
 */
-int roundingNumber(float number) {
-    int integerPart = (int)number; 
+unsigned int workloadRandomBelow(uint64_t *state, unsigned int bound) {
+    return (unsigned int)(((nextWorkloadRandom(state) >> 32) * bound) >> 32);
+}//workloadRandomBelow()
 
-    if (number - integerPart > 0) {
-        return integerPart + 1; 
-    } 
-    else {
-        return integerPart; 
+/* Gera o texto de uma tarefa da carga de trabalho sintética.
+   A tarefa começa pelo cabeçalho e pelas declarações das variáveis, cujos tamanhos somados ao cabeçalho cabem na
+   memória lógica padrão, seguidos das instruções: leituras de disco no percentual pedido e, nas demais, acessos a
+   posições válidas de variáveis sorteadas. Cada tarefa tem um estado próprio, derivado da semente e do seu índice,
+   de forma que a tarefa i é a mesma qualquer que seja o número de tarefas da carga.
+   Parâmetros:
+   - spec: Especificação da carga de trabalho.
+   - index: Índice da tarefa na carga.
+   - size: Recebe a quantidade de bytes gerados.
+   Retorno:
+   - Texto da tarefa (deve ser liberado com free), ou NULL se não houve memória disponível.
+*/
+char* generateTaskSource(const WorkloadSpec* spec, unsigned int index, size_t *size) {
+    size_t capacity = ((size_t) spec->numberOfVariables + spec->numberOfInstructions + 1) * WORKLOAD_LINE_SIZE;
+    char *source = (char*)malloc(capacity);
+    unsigned int *variableSizes = (unsigned int*)malloc(spec->numberOfVariables * sizeof(unsigned int));
+    if (source == NULL || variableSizes == NULL) {
+        free(source);
+        free(variableSizes);
+        return NULL;
     }
-}//roundingNumber()
 
-/* Atualiza a paginação de uma tarefa com base nos bytes alocados.
-   Esta função atualiza os valores de paginação de uma tarefa com base na quantidade de bytes alocados.
+    uint64_t state = index;
+    state = spec->seed ^ nextWorkloadRandom(&state);
+
+    unsigned int headerBytes = workloadRandomBelow(&state, DEFAULT_LOGICAL_MEMORY_SIZE / 4 + 1);
+    // O cabeçalho ocupa páginas inteiras; as variáveis dividem o restante da memória lógica.
+    unsigned int headerPages = (headerBytes + DEFAULT_PAGE_SIZE - 1) / DEFAULT_PAGE_SIZE;
+    unsigned int variableLimit = (DEFAULT_LOGICAL_MEMORY_SIZE - headerPages * DEFAULT_PAGE_SIZE) / spec->numberOfVariables;
+    size_t length = snprintf(source, capacity, INSTRUCTION_HEADER_PREFIX "%u\n", headerBytes);
+    for (unsigned int i = 0; i < spec->numberOfVariables; i++) {
+        variableSizes[i] = 1 + workloadRandomBelow(&state, variableLimit);
+        length += snprintf(source + length, capacity - length, "v%u " INSTRUCTION_NEW_KEYWORD " %u\n", i, variableSizes[i]);
+    }
+    for (unsigned int i = 0; i < spec->numberOfInstructions; i++) {
+        if (workloadRandomBelow(&state, 100) < spec->diskReadPercent) {
+            length += snprintf(source + length, capacity - length, INSTRUCTION_READ_DISK "\n");
+        }
+        else {
+            unsigned int variable = workloadRandomBelow(&state, spec->numberOfVariables);
+            length += snprintf(source + length, capacity - length, "v%u[%u]\n", variable, workloadRandomBelow(&state, variableSizes[variable]));
+        }
+    }
+    free(variableSizes);
+    *size = length;
+    return source;
+}//generateTaskSource()
+
+/* Grava uma carga de trabalho sintética em arquivos de tarefa, um por tarefa, no diretório informado.
+   O diretório é criado se não existir, e os arquivos podem ser usados pelo simulador com -g ou compilados com tsmm-compile.
    Parâmetros:
-   - taskDescriptor: Ponteiro para o descritor de tarefa (TaskDescriptor) a ser atualizado.
-   - bytes: Quantidade de bytes alocados.
+   - spec: Especificação da carga de trabalho.
+   - directory: Diretório que recebe os arquivos.
+   Retorno:
+   - TRUE se todos os arquivos foram gravados, FALSE caso contrário.
 */
-void updatePagination(TaskDescriptor* taskDescriptor, unsigned int bytes) {
-    taskDescriptor->pagination.bytesAllocated = bytes;
-    taskDescriptor->pagination.finalPage = roundingNumber((float) taskDescriptor->pagination.bytesAllocated / LOGICAL_PHYSICAL_PAGE_SIZE);
-    taskDescriptor->pagination.bytesAllocated = taskDescriptor->pagination.finalPage * LOGICAL_PHYSICAL_PAGE_SIZE - 1;
-    taskDescriptor->pagination.physicalBytesAllocated += taskDescriptor->pagination.bytesAllocated;
-}//updatePagination()
+boolean writeWorkload(const WorkloadSpec* spec, const char *directory) {
+    if (mkdir(directory, 0777) != 0 && errno != EEXIST) {
+        fprintf(stderr, WORKLOAD_WRITE_ERROR, directory);
+        return FALSE;
+    }
+    for (unsigned int i = 0; i < spec->numberOfTasks; i++) {
+        FileName taskName;
+        if (snprintf(taskName, FILE_NAME_SIZE, WORKLOAD_FILE_NAME, directory, i) >= FILE_NAME_SIZE) {
+            fprintf(stderr, WORKLOAD_WRITE_ERROR, directory);
+            return FALSE;
+        }
+        size_t size;
+        char *source = generateTaskSource(spec, i, &size);
+        FILE *file = source != NULL ? fopen(taskName, "w") : NULL;
+        boolean written = file != NULL && fwrite(source, 1, size, file) == size;
+        if (file != NULL && fclose(file) != 0) {
+            written = FALSE;
+        }
+        free(source);
+        if (!written) {
+            fprintf(stderr, WORKLOAD_WRITE_ERROR, taskName);
+            return FALSE;
+        }
+    }
+    return TRUE;
+}//writeWorkload()
 
-/* Processa um cabeçalho de instrução para atualizar a paginação de uma tarefa.
-   Esta função processa o cabeçalho de uma instrução para atualizar os valores de paginação
-   de uma tarefa com base nos bytes especificados no cabeçalho.
+/* Gera em memória o texto de todas as tarefas de uma carga de trabalho sintética.
    Parâmetros:
-   - instruction: String contendo a instrução do cabeçalho.
-   - taskDescriptor: Ponteiro para o descritor de tarefa (TaskDescriptor) a ser atualizado.
+   - workload: Carga de trabalho a ser criada.
+   - spec: Especificação da carga de trabalho.
    Retorno:
-   - Retorna TRUE se a operação for bem-sucedida; FALSE, caso contrário.
+   - TRUE se a carga foi gerada, FALSE se não houve memória disponível.
 */
-boolean header(String instruction, TaskDescriptor* taskDescriptor, RoundRobin* roundRobin) {
-    unsigned int bytes;
-    sscanf(instruction, "#%*[^=]=%u", &bytes);
-
-    if (taskDescriptor->pagination.finalPage > LARGEST_LOGICAL_MEMORY_SIZE) {
-        printf(ALLOCATION_SPACE_ERROR, taskDescriptor->task.nameOfTask, LARGEST_LOGICAL_MEMORY_SIZE);
-        finishTask(taskDescriptor, TRUE, roundRobin);
+boolean createWorkload(Workload* workload, const WorkloadSpec* spec) {
+    workload->spec = *spec;
+    workload->sources = (char**)calloc(spec->numberOfTasks, sizeof(char*));
+    workload->sizes = (size_t*)calloc(spec->numberOfTasks, sizeof(size_t));
+    workload->numberOfLines = (unsigned long long) spec->numberOfTasks * (1 + spec->numberOfVariables + spec->numberOfInstructions);
+    if (workload->sources == NULL || workload->sizes == NULL) {
+        freeWorkload(workload);
         return FALSE;
     }
-    updatePagination(taskDescriptor, bytes);
-    
+    for (unsigned int i = 0; i < spec->numberOfTasks; i++) {
+        workload->sources[i] = generateTaskSource(spec, i, &workload->sizes[i]);
+        if (workload->sources[i] == NULL) {
+            freeWorkload(workload);
+            return FALSE;
+        }
+    }
     return TRUE;
-}//header()
+}//createWorkload()
 
-/* Determina o tipo de instrução baseado em padrões regex.
-   Esta função verifica o tipo de instrução com base em padrões regex e retorna
-   um enum correspondente ao tipo de instrução encontrado.
+/* Libera o texto das tarefas de uma carga de trabalho sintética.
    Parâmetros:
-   - instruction: String contendo a instrução a ser verificada.
-   Retorno:
-   - Retorna um enum do tipo Instruction correspondente ao tipo de instrução encontrado,
-     ou -1 caso não corresponda a nenhum padrão conhecido.
+   - workload: Carga de trabalho a ser liberada.
 */
-Instruction determineInstructionType(String instruction) {
-    if (matchRegex(instruction, INSTRUCTION_HEADER_REGEX)) {
-        return HEADER;
-    } 
-    else if (matchRegex(instruction, INSTRUCTION_NEW_REGEX)) {
-        return NEW;
-    } 
-    else if (matchRegex(instruction, INSTRUCTION_IDEX_REGEX)) {
-        return MEMORY_ACCESS;
-    } 
-    else if (matchRegex(instruction, INSTRUCTION_READ_DISK_REGEX)) {
-        return READ_DISK;
-    } 
-    else {
-        return -1; 
+void freeWorkload(Workload* workload) {
+    if (workload->sources != NULL) {
+        for (unsigned int i = 0; i < workload->spec.numberOfTasks; i++) {
+            free(workload->sources[i]);
+        }
     }
-}//determineInstructionType()
+    free(workload->sources);
+    free(workload->sizes);
+    workload->sources = NULL;
+    workload->sizes = NULL;
+}//freeWorkload()
 
-/* Executa as instruções de uma tarefa dentro do quantum definido.
-   Esta função executa as instruções de uma tarefa dentro do quantum definido pelo RoundRobin.
+/* Calcula o tempo decorrido desde um instante do relógio monotônico.
    Parâmetros:
-   - queue: Ponteiro para a fila de descritores de tarefa.
-   - roundRobin: Ponteiro para a estrutura RoundRobin contendo informações do sistema.
-   - taskDescriptor: Ponteiro para o descritor da tarefa em execução.
-   - tasks: Array de descritores de tarefas.
-   - numberOfTasks: Número total de tarefas.
+   - start: Instante inicial, lido com clock_gettime(CLOCK_MONOTONIC).
    Retorno:
-   - Retorna o valor do contador de preempção após a execução das instruções.
+   - Tempo decorrido, em nanossegundos.
 */
-int executeInstruction(TaskDescriptorQueue* queue, RoundRobin* roundRobin, TaskDescriptor* taskDescriptor, TaskDescriptor tasks[], int numberOfTasks) {
-    while (roundRobin->preemptionTimeCounter <= QUANTUM) {
-        if (taskDescriptor != NULL && taskDescriptor->status == RUNNING) {
-            String instruction;
-            if (fgets(instruction, sizeof(instruction), taskDescriptor->task.taskFile) != NULL) {
-                roundRobin->totalCPUClocks += UT;
-                taskDescriptor->cpuTime += UT;
+double elapsedNanoseconds(const struct timespec* start) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start->tv_sec) * 1e9 + (now.tv_nsec - start->tv_nsec);
+}//elapsedNanoseconds()
 
-                Instruction instructionType = determineInstructionType(instruction);
+#ifdef TSMM_INSTRUMENTATION
 
-                switch (instructionType) {
-                    case HEADER:
-                        // Decrementando os contatores, pois o header não deve ser processado no tempo final.
-                        roundRobin->preemptionTimeCounter--;
-                        roundRobin->totalCPUClocks-= UT;
-                        taskDescriptor->cpuTime-= UT;
-                        header(instruction, taskDescriptor, roundRobin);
-                        break;
-                    case NEW:
-                        new(instruction, taskDescriptor, roundRobin);
-                        break;
-                    case MEMORY_ACCESS:
-                        memoryAccess(instruction, taskDescriptor, roundRobin);
-                        break;
-                    case READ_DISK:
-                        readDisk(taskDescriptor);
-                        roundRobin->totalOutputTime += SUSPENDED_TIME;
-                        break;
-                    default:
-                        finishTask(taskDescriptor, FALSE, roundRobin);
-                        break;
-                }
-            } 
-            else {
-                finishTask(taskDescriptor, FALSE, roundRobin);
-                break;
-            }
-        }
-        roundRobin->preemptionTimeCounter += UT;
+const char *const INSTRUMENTATION_TIMER_NAMES[NUMBER_OF_INSTRUMENTATION_TIMERS] = {
+    "validateFile", "determineInstructionType", "executeInstruction", "checkAndUpdateSuspendedTasks", "printReport"
+};
+
+const char *const INSTRUMENTATION_COUNTER_NAMES[NUMBER_OF_INSTRUMENTATION_COUNTERS] = {
+    "trocas de contexto", "enfileiramentos", "desenfileiramentos", "leituras de disco"
+};
+
+_Thread_local Instrumentation instrumentation;
+
+/* Acumula o tempo de um trecho medido na instrumentação.
+   Parâmetros:
+   - timer: Trecho medido.
+   - start: Instante em que o trecho começou, lido com clock_gettime(CLOCK_MONOTONIC).
+*/
+void stopInstrumentationTimer(InstrumentationTimer timer, const struct timespec* start) {
+    instrumentation.calls[timer]++;
+    instrumentation.nanoseconds[timer] += elapsedNanoseconds(start);
+}//stopInstrumentationTimer()
+
+/* Imprime a tabela da instrumentação da simulação: chamadas, tempo total e tempo médio de cada trecho medido,
+   seguidos das contagens de eventos. O tempo de validateFile inclui o de determineInstructionType.
+   Parâmetros:
+   - output: Saída da tabela.
+*/
+void printInstrumentation(FILE *output) {
+    fprintf(output, "\n\tInstrumentação:\n");
+    fprintf(output, "\t\ttrecho                               chamadas     total (ms)     média (ns)\n");
+    for (int i = 0; i < NUMBER_OF_INSTRUMENTATION_TIMERS; i++) {
+        unsigned long long calls = instrumentation.calls[i];
+        double nanoseconds = instrumentation.nanoseconds[i];
+        fprintf(output, "\t\t%-30s %14llu %14.3f %14.1f\n", INSTRUMENTATION_TIMER_NAMES[i], calls,
+            nanoseconds / 1e6, calls > 0 ? nanoseconds / calls : 0.0);
     }
-    return roundRobin->preemptionTimeCounter;
-}//executeInstruction()
+    for (int i = 0; i < NUMBER_OF_INSTRUMENTATION_COUNTERS; i++) {
+        fprintf(output, "\t\t%-30s %14llu\n", INSTRUMENTATION_COUNTER_NAMES[i], instrumentation.counters[i]);
+    }
+}//printInstrumentation()
 
-/* Inicializa a estrutura RoundRobin com valores iniciais.
-   Esta função atribui valores iniciais aos campos da estrutura RoundRobin.
+#endif
+
+/* Imprime o resultado de um microbenchmark: o custo médio de uma operação e a vazão de operações.
    Parâmetros:
-   - roundRobin: Ponteiro para a estrutura RoundRobin a ser inicializada.
+   - component: Componente medido.
+   - numberOfTasks: Número de tarefas da carga de trabalho.
+   - operation: Unidade medida (linha, tarefa, instrução simulada...).
+   - nanoseconds: Tempo total medido.
+   - operations: Número de operações executadas no tempo medido.
 */
-void initializeRoundRobin(RoundRobin* roundRobin) {
-    roundRobin->totalCPUClocks = 0;
-    roundRobin->preemptionTimeCounter = 1;
-    roundRobin->waitTime = 0;
-}//initializeRoundRobin()
+void printBenchmarkResult(const char *component, unsigned int numberOfTasks, const char *operation, double nanoseconds, unsigned long long operations) {
+    double perOperation = operations > 0 ? nanoseconds / operations : 0.0;
+    double perSecond = nanoseconds > 0 ? operations * 1e9 / nanoseconds : 0.0;
+    printf("%-34s %8u  %-18s %12.1f %16.0f\n", component, numberOfTasks, operation, perOperation, perSecond);
+}//printBenchmarkResult()
 
-/* Inicializa a fila de descritores de tarefa.
-   Esta função inicializa a fila de descritores de tarefa, enfileirando as tarefas prontas e não abortadas.
+/* Mede a decodificação de instruções ('determineInstructionType()') sobre todas as linhas da carga de trabalho.
    Parâmetros:
-   - taskDescriptorQueue: Ponteiro para a fila de descritores de tarefa a ser inicializada.
-   - tasks: Array de descritores de tarefa.
-   - numberOfTasks: Número total de tarefas no array.
+   - workload: Carga de trabalho sintética.
 */
-void initializeTaskQueue(TaskDescriptorQueue* taskDescriptorQueue, TaskDescriptor tasks[], int numberOfTasks) {
-    for (int i = 0; i < numberOfTasks; i++) {
-        if (tasks[i].status == READY && tasks[i].aborted == FALSE) {
-            tasks[i].startTime = i;
-            tasks[i].pagination.initialBytesAllocated = RESERVED_PROGRAM_MEMORY_SIZE + i * LARGEST_LOGICAL_MEMORY_SIZE;
-            tasks[i].pagination.physicalBytesAllocated = tasks[i].pagination.initialBytesAllocated;
-            enqueueTaskDescriptor(taskDescriptorQueue, &tasks[i]);
+void benchmarkInstructionDecoding(const Workload* workload) {
+    ParsedInstruction parsed;
+    volatile unsigned int decoded = 0;
+    unsigned long long operations = 0;
+    double elapsed;
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    do {
+        for (unsigned int i = 0; i < workload->spec.numberOfTasks; i++) {
+            const char *line = workload->sources[i];
+            const char *end = line + workload->sizes[i];
+            while (line < end) {
+                const char *newLine = memchr(line, '\n', end - line);
+                const char *lineEnd = newLine != NULL ? newLine : end;
+                decoded += determineInstructionType(line, lineEnd - line, &parsed);
+                line = lineEnd + 1;
+            }
         }
-    }
-}//initializeTaskQueue()
+        operations += workload->numberOfLines;
+        elapsed = elapsedNanoseconds(&start);
+    } while (elapsed < BENCHMARK_MINIMUM_TIME_NS);
+    printBenchmarkResult("determineInstructionType", workload->spec.numberOfTasks, "linha", elapsed, operations);
+}//benchmarkInstructionDecoding()
 
-/* Executa o escalonamento e execução das tarefas.
-   Esta função executa o escalonamento e a execução das tarefas enquanto houver tarefas a serem processadas.
+/* Mede as operações das filas de descritores: a fila encadeada das tarefas prontas (enfileirar e desenfileirar)
+   e o heap de tarefas suspensas ordenado pelo instante de despertar (inserir e remover).
    Parâmetros:
-   - taskDescriptorQueue: Ponteiro para a fila de descritores de tarefa.
-   - roundRobin: Estrutura de informações do Round-Robin.
-   - tasks: Array de descritores de tarefa.
-   - numberOfTasks: Número total de tarefas no array.
+   - workload: Carga de trabalho sintética, que define o número de descritores e a semente dos instantes de despertar.
 */
-void runTasks(TaskDescriptorQueue* taskDescriptorQueue, RoundRobin* roundRobin, TaskDescriptor tasks[], int numberOfTasks) {
-    while (TRUE) {
-        // O loop so será finalizado quando todas as tarefas estiverem com estado igual a FINISH.
-        if (allTasksFinished(tasks, numberOfTasks)) {
-            destroyTaskDescriptorQueue(taskDescriptorQueue);
-            break;
+void benchmarkTaskQueues(const Workload* workload) {
+    unsigned int numberOfTasks = workload->spec.numberOfTasks;
+    TaskDescriptor *descriptors = (TaskDescriptor*)calloc(numberOfTasks, sizeof(TaskDescriptor));
+    TaskDescriptorQueue *queue = createTaskDescriptorQueue();
+    TaskDescriptorHeap *heap = createTaskDescriptorHeap(compareWakeUpTime);
+    if (descriptors == NULL) {
+        fprintf(stderr, WORKLOAD_ERROR, numberOfTasks);
+        destroyTaskDescriptorQueue(queue);
+        destroyTaskDescriptorHeap(heap);
+        return;
+    }
+    uint64_t state = workload->spec.seed;
+    for (unsigned int i = 0; i < numberOfTasks; i++) {
+        descriptors[i].wakeUpTime = workloadRandomBelow(&state, numberOfTasks);
+        descriptors[i].wakeUpSequence = i;
+    }
+
+    unsigned long long operations = 0;
+    double elapsed;
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    do {
+        for (unsigned int i = 0; i < numberOfTasks; i++) {
+            enqueueTaskDescriptor(queue, &descriptors[i]);
         }
-        
-        // A fila contém apenas tarefas com estados READY.
-        TaskDescriptor* taskRunningPtr = dequeueTaskDescriptor(taskDescriptorQueue);
+        while (dequeueTaskDescriptor(queue) != NULL) {
+            operations++;
+        }
+        elapsed = elapsedNanoseconds(&start);
+    } while (elapsed < BENCHMARK_MINIMUM_TIME_NS);
+    printBenchmarkResult("enqueue/dequeueTaskDescriptor", numberOfTasks, "tarefa", elapsed, operations);
 
-        // Alterando o estado para RUNNING, pois a tarefa será executada.
-        if (taskRunningPtr != NULL) {
-            taskRunningPtr->status = RUNNING;
+    operations = 0;
+    boolean allocated = TRUE;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    do {
+        for (unsigned int i = 0; i < numberOfTasks && allocated; i++) {
+            allocated = pushTaskDescriptor(heap, &descriptors[i]);
         }
-        
-        // Executa a tarefa que foi retirada da fila.
-        executeInstruction(taskDescriptorQueue, roundRobin, taskRunningPtr, tasks, numberOfTasks);
-        
-        if (taskRunningPtr != NULL && taskRunningPtr->status == RUNNING) {
-            // Caso a tarefa não sejá suspensa durante sua excecução, seu estado será mudada para READY e ela será adcionada a fila.
-            taskRunningPtr->status = READY;
-            enqueueTaskDescriptor(taskDescriptorQueue, taskRunningPtr);
+        while (popTaskDescriptor(heap) != NULL) {
+            operations++;
         }
-        
-        //Decrementando o tempo de suspensão das tarefas com estado SUSPENDED.
-        checkAndUpdateSuspendedTasks(taskDescriptorQueue, tasks, numberOfTasks, roundRobin->preemptionTimeCounter);
-        
-        // Resetando o tempo de preempção.
-        roundRobin->preemptionTimeCounter = UT;
+        elapsed = elapsedNanoseconds(&start);
+    } while (allocated && elapsed < BENCHMARK_MINIMUM_TIME_NS);
+    if (allocated) {
+        printBenchmarkResult("push/popTaskDescriptor", numberOfTasks, "tarefa", elapsed, operations);
     }
-}//runTasks()
+    else {
+        fprintf(stderr, WORKLOAD_ERROR, numberOfTasks);
+    }
+
+    destroyTaskDescriptorQueue(queue);
+    destroyTaskDescriptorHeap(heap);
+    free(descriptors);
+}//benchmarkTaskQueues()
 
-/* Agenda e executa as tarefas usando o algoritmo Round-Robin.
-   Esta função cria uma estrutura RoundRobin, uma fila de descritores de tarefa e coordena a execução das tarefas
-   usando o algoritmo Round-Robin até que todas as tarefas tenham sido executadas.
+/* Mede o despertar das tarefas suspensas ('checkAndUpdateSuspendedTasks()'), avançando o relógio uma unidade de tempo
+   por chamada até todas as tarefas despertarem. As tarefas são suspensas com instantes de despertar sorteados entre
+   1 e o número de tarefas, e voltam às filas de prontos do Round-Robin; apenas o despertar é medido.
    Parâmetros:
-   - tasks: Array de descritores de tarefa.
-   - numberOfTasks: Número total de tarefas no array.
-   Retorno:
-   - Estrutura RoundRobin com informações de execução das tarefas.
+   - workload: Carga de trabalho sintética, que define o número de tarefas e a semente dos instantes de despertar.
 */
-RoundRobin scheduleTasks(TaskDescriptor tasks[], int numberOfTasks) {
-    RoundRobin roundRobin;
-    TaskDescriptorQueue* taskDescriptorQueue = createTaskDescriptorQueue(); 
+void benchmarkSuspendedTasks(const Workload* workload) {
+    unsigned int numberOfTasks = workload->spec.numberOfTasks;
+    TaskDescriptor *descriptors = (TaskDescriptor*)calloc(numberOfTasks, sizeof(TaskDescriptor));
+    if (descriptors == NULL) {
+        fprintf(stderr, WORKLOAD_ERROR, numberOfTasks);
+        return;
+    }
+    const SchedulingPolicy* policy = findSchedulingPolicy(DEFAULT_SCHEDULING_POLICY, strlen(DEFAULT_SCHEDULING_POLICY));
+    TlbConfiguration tlb;
+    memset(&tlb, 0, sizeof(TlbConfiguration));
 
-    initializeRoundRobin(&roundRobin);
-    initializeTaskQueue(taskDescriptorQueue, tasks, numberOfTasks);
-    runTasks(taskDescriptorQueue, &roundRobin, tasks, numberOfTasks);
-    return roundRobin;
-}//scheduleTasks()
+    unsigned long long operations = 0;
+    double elapsed = 0;
+    boolean allocated = TRUE;
+    do {
+        Scheduler scheduler;
+        RoundRobin roundRobin;
+        initializeScheduler(&scheduler, policy, 1, &tlb);
+        initializeRoundRobin(&roundRobin);
+        uint64_t state = workload->spec.seed;
+        for (unsigned int i = 0; i < numberOfTasks && allocated; i++) {
+            descriptors[i].status = SUSPENDED;
+            descriptors[i].wakeUpTime = 1 + workloadRandomBelow(&state, numberOfTasks);
+            descriptors[i].wakeUpSequence = i;
+            allocated = pushTaskDescriptor(scheduler.wakeUpQueue, &descriptors[i]);
+        }
+        if (!allocated) {
+            destroyScheduler(&scheduler);
+            break;
+        }
+        roundRobin.tasksPerStatus[SUSPENDED] = numberOfTasks;
+
+        struct timespec start;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        while (!isTaskDescriptorHeapEmpty(scheduler.wakeUpQueue)) {
+            checkAndUpdateSuspendedTasks(&scheduler, &roundRobin, UT);
+        }
+        elapsed += elapsedNanoseconds(&start);
+        operations += numberOfTasks;
+        destroyScheduler(&scheduler);
+    } while (elapsed < BENCHMARK_MINIMUM_TIME_NS);
+    if (allocated) {
+        printBenchmarkResult("checkAndUpdateSuspendedTasks", numberOfTasks, "tarefa despertada", elapsed, operations);
+    }
+    else {
+        fprintf(stderr, WORKLOAD_ERROR, numberOfTasks);
+    }
+    free(descriptors);
+}//benchmarkSuspendedTasks()
 
-/* Verifica se uma string corresponde a um padrão de expressão regular.
-   Esta função utiliza a biblioteca POSIX para compilar e executar uma expressão regular
-   e verifica se a string fornecida corresponde ao padrão especificado.
+/* Decodifica a carga de trabalho em uma tabela de tarefas e executa uma simulação Round-Robin com a máquina padrão,
+   medindo apenas o escalonamento ('scheduleTasks()').
    Parâmetros:
-   - string: A string a ser verificada.
-   - pattern: O padrão de expressão regular a ser comparado com a string.
+   - workload: Carga de trabalho sintética.
+   - table: Tabela que recebe as tarefas simuladas (deve ser liberada com 'freeTaskTable()' se o retorno não for 0).
+   - roundRobin: Recebe o resultado da simulação.
+   - output: Saída das mensagens da simulação.
+   - elapsed: Recebe o tempo da simulação, em nanossegundos.
    Retorno:
-   - TRUE se a string corresponde ao padrão, FALSE caso contrário.
+   - Número de instruções simuladas, ou 0, com a tabela já liberada e o erro impresso, se não houve memória para a tabela
+     de tarefas, alguma tarefa foi abortada ou nenhuma instrução foi simulada.
 */
-boolean matchRegex(String string, const char *pattern) {
-    regex_t regex;
-    int result;
+unsigned long long simulateWorkload(const Workload* workload, TaskTable* table, RoundRobin* roundRobin, FILE *output, double *elapsed) {
+    int numberOfTasks = (int) workload->spec.numberOfTasks;
+    if (!createTaskTable(table, numberOfTasks)) {
+        fprintf(stderr, WORKLOAD_ERROR, workload->spec.numberOfTasks);
+        return 0;
+    }
+    MachineConfiguration machine;
+    memset(&machine, 0, sizeof(MachineConfiguration));
+    machine.pageSize = DEFAULT_PAGE_SIZE;
+    machine.physicalMemorySize = DEFAULT_PHYSICAL_MEMORY_SIZE;
+    machine.logicalMemorySize = DEFAULT_LOGICAL_MEMORY_SIZE;
+    machine.quantum = DEFAULT_QUANTUM;
+    configureMachine(&machine);
+    TlbConfiguration tlb;
+    memset(&tlb, 0, sizeof(TlbConfiguration));
 
-    result = regcomp(&regex, pattern, REG_EXTENDED);
-    if (result != 0) {
-        return FALSE;
+    ProgramPool pool;
+    initializeProgramPool(&pool, DEFAULT_RESIDENT_PROGRAMS, output);
+    TaskDescriptor *tasksDescriptions = table->descriptors;
+    for (int i = 0; i < numberOfTasks; i++) {
+        initializeTaskDescriptor(&tasksDescriptions[i], &table->tasks[i], &table->memories[i], BENCHMARK_PROGRAM_NAME);
+        if (!parseTaskProgram(workload->sources[i], workload->sizes[i], &table->tasks[i].program)
+            || !initializeTaskVariables(&tasksDescriptions[i])) {
+            freeTaskProgram(&table->tasks[i].program);
+            tasksDescriptions[i].aborted = TRUE;
+            tasksDescriptions[i].status = FINISHED;
+        }
+        tasksDescriptions[i].numberOfInstructions = table->tasks[i].program.numberOfInstructions;
+        if (!tasksDescriptions[i].aborted) {
+            admitTaskProgram(&pool, &table->tasks[i]);
+        }
     }
-    
-    result = regexec(&regex, string, 0, NULL, 0);
-    regfree(&regex);
 
-    if (result == 0) {
-        return TRUE;
-    } 
-    else {
-        return FALSE; 
+    const SchedulingPolicy* policy = findSchedulingPolicy(DEFAULT_SCHEDULING_POLICY, strlen(DEFAULT_SCHEDULING_POLICY));
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    *roundRobin = scheduleTasks(tasksDescriptions, numberOfTasks, policy, NULL, &tlb, &machine, DEFAULT_NUMBER_OF_CORES, NULL, NULL, output);
+    *elapsed = elapsedNanoseconds(&start);
+
+    // Uma tarefa abortada executaria menos instruções que as geradas e distorceria a medida.
+    if (roundRobin->abortedTasks > 0) {
+        fprintf(stderr, WORKLOAD_ABORTED_ERROR, roundRobin->abortedTasks, workload->spec.numberOfTasks);
+        freeTaskTable(table);
+        return 0;
+    }
+    unsigned long long instructions = 0;
+    for (int i = 0; i < numberOfTasks; i++) {
+        instructions += tasksDescriptions[i].cpuTime;
     }
-}//matchRegex()
+    if (instructions == 0) {
+        fprintf(stderr, WORKLOAD_ERROR, workload->spec.numberOfTasks);
+        freeTaskTable(table);
+    }
+    return instructions;
+}//simulateWorkload()
 
-/* Valida o número de argumentos fornecidos ao programa.
-   Esta função verifica se o número de argumentos está dentro do intervalo esperado
-   para a execução do programa, com base na quantidade de tarefas previamente definida.
+/* Mede a simulação completa, em instruções simuladas por segundo, e em seguida os geradores de relatório de cada
+   formato sobre o resultado da última simulação. Os relatórios são gravados em /dev/null.
    Parâmetros:
-   - numberOfArguments: O número de argumentos fornecidos ao programa.
+   - workload: Carga de trabalho sintética.
    Retorno:
-   - TRUE se o número de argumentos estiver dentro do intervalo esperado, FALSE caso contrário.
+   - TRUE se a simulação foi medida, FALSE se não houve memória ou alguma tarefa da carga foi abortada.
 */
-boolean validateNumberOfArguments(int numberOfArguments) {
-    if (numberOfArguments < 2 || numberOfArguments > NUMBER_OF_TASKS + 1) {
+boolean benchmarkSimulationAndReports(const Workload* workload) {
+    FILE *output = fopen("/dev/null", "w");
+    if (output == NULL) {
+        fprintf(stderr, FILE_OPEN_ERROR, "/dev/null");
         return FALSE;
     }
+    unsigned int numberOfTasks = workload->spec.numberOfTasks;
+    TaskTable table;
+    RoundRobin roundRobin;
+    unsigned long long operations = 0;
+    double elapsed = 0;
+    while (TRUE) {
+        double simulation;
+        unsigned long long instructions = simulateWorkload(workload, &table, &roundRobin, output, &simulation);
+        if (instructions == 0) {
+            fputc('\n', stderr);
+            fclose(output);
+            return FALSE;
+        }
+        operations += instructions;
+        elapsed += simulation;
+        if (elapsed >= BENCHMARK_MINIMUM_TIME_NS) {
+            break;
+        }
+        freeTaskTable(&table);
+    }
+    printBenchmarkResult("scheduleTasks", numberOfTasks, "instrução simulada", elapsed, operations);
+
+    for (int i = 0; i < NUMBER_OF_REPORT_FORMATS; i++) {
+        const ReportFormat* format = &REPORT_FORMATS[i];
+        String component;
+        snprintf(component, STRING_DEFAULT_SIZE, "printReport(%s)", format->name);
+        operations = 0;
+        struct timespec start;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        do {
+            format->printReport(output, &roundRobin, table.descriptors, (int) numberOfTasks);
+            operations += numberOfTasks;
+            elapsed = elapsedNanoseconds(&start);
+        } while (elapsed < BENCHMARK_MINIMUM_TIME_NS);
+        printBenchmarkResult(component, numberOfTasks, "tarefa", elapsed, operations);
+    }
+    freeTaskTable(&table);
+    fclose(output);
     return TRUE;
-}//validateNumberOfArguments()
+}//benchmarkSimulationAndReports()
 
-/* Inicializa um descritor de tarefa.
-   Esta função inicializa um descritor de tarefa com valores padrão e abre o arquivo de tarefa associado.
+/* Lê a lista de contagens de tarefas, separada por vírgulas.
    Parâmetros:
-   - descriptor: O descritor de tarefa a ser inicializado.
-   - taskName: O nome da tarefa para identificação.
+   - text: Lista de contagens de tarefas.
+   - counts: Recebe as contagens, até MAXIMUM_WORKLOAD_TASK_COUNTS.
+   - numberOfCounts: Recebe o número de contagens lidas.
+   Retorno:
+   - TRUE se todas as contagens são números válidos, FALSE caso contrário.
 */
-void initializeTaskDescriptor(TaskDescriptor* descriptor, String taskName) {
-    // Inicializa todos os atributos com 0
-    memset(descriptor, 0, sizeof(TaskDescriptor));
-
-    strcpy(descriptor->task.nameOfTask, taskName);
-    FileName fullFileName;
-    snprintf(fullFileName, FILE_NAME_SIZE, "%s%s", taskName, FILE_EXTENSION);
-    descriptor->task.taskFile = fopen(fullFileName, FILE_OPENING_OPTION);
-    descriptor->status = READY;
-    descriptor->aborted = FALSE;
-
-    // Inicializa as variáveis da tarefa com 0
-    for (int i = 0; i < MAXIMUN_NUMBER_OF_VARIABLES; ++i) {
-        memset(descriptor->variable[i].name, 0, STRING_DEFAULT_SIZE);
-        descriptor->variable[i].value = 0;
+boolean parseTaskCounts(const char *text, unsigned int counts[], unsigned int *numberOfCounts) {
+    char value[STRING_DEFAULT_SIZE];
+    *numberOfCounts = 0;
+    while (TRUE) {
+        size_t length = strcspn(text, POLICY_LIST_SEPARATOR);
+        if (length >= STRING_DEFAULT_SIZE || *numberOfCounts == MAXIMUM_WORKLOAD_TASK_COUNTS) {
+            return FALSE;
+        }
+        memcpy(value, text, length);
+        value[length] = NULL_CHAR;
+        if (!parseMachineValue(value, 1, MAXIMUM_WORKLOAD_TASKS, &counts[*numberOfCounts])) {
+            return FALSE;
+        }
+        (*numberOfCounts)++;
+        if (text[length] == NULL_CHAR) {
+            return TRUE;
+        }
+        text += length + 1;
     }
-}//initializeTaskDescriptor()
+}//parseTaskCounts()
 
-/* Valida um arquivo de tarefa.
-   Esta função verifica se um arquivo de tarefa possui um formato válido, verificando suas instruções.
+/* Microbenchmarks e gerador de cargas de trabalho sintéticas (tsmm-bench).
+   Sem -w, gera em memória uma carga de trabalho para cada contagem de tarefas (-n) e mede o custo por operação e a
+   vazão da decodificação de instruções, das filas de descritores, do despertar das tarefas suspensas, da simulação
+   completa (instruções simuladas por segundo) e dos relatórios. Com -w, grava a carga de uma única contagem de tarefas
+   em arquivos de tarefa no diretório informado. As opções -i, -v e -d definem as instruções, as variáveis e o percentual
+   de leituras de disco de cada tarefa, e -s a semente: a mesma semente gera sempre a mesma carga.
    Parâmetros:
-   - fileName: O nome do arquivo de tarefa a ser validado.
+   - numberOfArguments: Número de argumentos do programa.
+   - arguments: Argumentos do programa (opções).
    Retorno:
-   - TRUE se o arquivo possui um formato válido, FALSE caso contrário.
+   - EXIT_SUCCESS se a execução for bem-sucedida, EXIT_FAILURE caso contrário.
 */
-boolean validateFile(FileName fileName) {
-    FileName fullFileName;
-    snprintf(fullFileName, FILE_NAME_SIZE, "%s%s", fileName, FILE_EXTENSION);
-
-    FILE *file = fopen(fullFileName, FILE_OPENING_OPTION);
+int tsmmBench(int numberOfArguments, char *arguments[]) {
+    WorkloadSpec spec;
+    spec.numberOfInstructions = DEFAULT_WORKLOAD_INSTRUCTIONS;
+    spec.numberOfVariables = DEFAULT_WORKLOAD_VARIABLES;
+    spec.diskReadPercent = DEFAULT_WORKLOAD_DISK_PERCENT;
+    spec.seed = DEFAULT_WORKLOAD_SEED;
+    unsigned int counts[MAXIMUM_WORKLOAD_TASK_COUNTS];
+    unsigned int numberOfCounts;
+    parseTaskCounts(DEFAULT_WORKLOAD_TASK_COUNTS, counts, &numberOfCounts);
+    const char *directory = NULL;
 
-    if (file == NULL) {
-        printf(FILE_OPEN_ERROR, fileName);
-        return FALSE;
+    int option;
+    while ((option = getopt(numberOfArguments, arguments, "n:i:v:d:s:w:")) != -1) {
+        unsigned int seed;
+        boolean valid = TRUE;
+        switch (option) {
+            case 'n':
+                if (!parseTaskCounts(optarg, counts, &numberOfCounts)) {
+                    fprintf(stderr, INVALID_MACHINE_VALUE_ERROR, "tarefas", optarg);
+                    valid = FALSE;
+                }
+                break;
+            case 'i':
+                if (!parseMachineValue(optarg, 0, MAXIMUM_WORKLOAD_INSTRUCTIONS, &spec.numberOfInstructions)) {
+                    fprintf(stderr, INVALID_MACHINE_VALUE_ERROR, "instruções", optarg);
+                    valid = FALSE;
+                }
+                break;
+            case 'v':
+                if (!parseMachineValue(optarg, 1, MAXIMUM_WORKLOAD_VARIABLES, &spec.numberOfVariables)) {
+                    fprintf(stderr, INVALID_MACHINE_VALUE_ERROR, "variáveis", optarg);
+                    valid = FALSE;
+                }
+                break;
+            case 'd':
+                if (!parseMachineValue(optarg, 0, 100, &spec.diskReadPercent)) {
+                    fprintf(stderr, INVALID_MACHINE_VALUE_ERROR, "leituras de disco", optarg);
+                    valid = FALSE;
+                }
+                break;
+            case 's':
+                if (!parseMachineValue(optarg, 0, UINT_MAX, &seed)) {
+                    fprintf(stderr, INVALID_MACHINE_VALUE_ERROR, "semente", optarg);
+                    valid = FALSE;
+                }
+                else {
+                    spec.seed = seed;
+                }
+                break;
+            case 'w':
+                directory = optarg;
+                break;
+            default:
+                valid = FALSE;
+                break;
+        }
+        if (!valid) {
+            fprintf(stderr, BENCHMARK_USAGE_MESSAGE, arguments[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (optind < numberOfArguments || (directory != NULL && numberOfCounts != 1)) {
+        fprintf(stderr, BENCHMARK_USAGE_MESSAGE, arguments[0]);
+        return EXIT_FAILURE;
     }
-    String line;
 
-    if (fgets(line, sizeof(line), file) != NULL) {
-        if (!matchRegex(line, INSTRUCTION_HEADER_REGEX)) {
-            fclose(file);
-            return FALSE;
+    if (directory != NULL) {
+        spec.numberOfTasks = counts[0];
+        if (!writeWorkload(&spec, directory)) {
+            fputc('\n', stderr);
+            return EXIT_FAILURE;
         }
+        return EXIT_SUCCESS;
     }
 
-    while (fgets(line, sizeof(line), file) != NULL) {
-        if (!matchRegex(line, INSTRUCTION_NEW_REGEX) && !matchRegex(line, INSTRUCTION_IDEX_REGEX) && 
-            !matchRegex(line, INSTRUCTION_READ_DISK_REGEX)) {
-            fclose(file);
-            return FALSE;
+    printf("Carga sintética: semente %llu; por tarefa, %u instruções, %u variáveis e %u%% de leituras de disco\n\n",
+        (unsigned long long) spec.seed, spec.numberOfInstructions, spec.numberOfVariables, spec.diskReadPercent);
+    printf("%-34s %8s  %-18s %12s %16s\n", "componente", "tarefas", "unidade", "ns/op", "op/s");
+    int result = EXIT_SUCCESS;
+    for (unsigned int i = 0; i < numberOfCounts; i++) {
+        spec.numberOfTasks = counts[i];
+        Workload workload;
+        if (!createWorkload(&workload, &spec)) {
+            fprintf(stderr, WORKLOAD_ERROR, spec.numberOfTasks);
+            fputc('\n', stderr);
+            result = EXIT_FAILURE;
+            continue;
         }
+        benchmarkInstructionDecoding(&workload);
+        benchmarkTaskQueues(&workload);
+        benchmarkSuspendedTasks(&workload);
+        if (!benchmarkSimulationAndReports(&workload)) {
+            result = EXIT_FAILURE;
+        }
+        freeWorkload(&workload);
+        fflush(stdout);
     }
-    fclose(file);
-    return TRUE;
-}//validateFile()
+    return result;
+}//tsmmBench()
 
 /* Função principal para execução do escalonamento de tarefas e imprimir os relatórios.
+   As tarefas podem ser informadas como argumentos, por um manifesto (-m) ou por um padrão glob (-g).
+   A opção -p escolhe a política de escalonamento; uma lista separada por vírgulas executa uma simulação
+   por política sobre a mesma carga de trabalho. A opção -r ativa a paginação sob demanda com as políticas de
+   substituição de páginas informadas, uma simulação por combinação de políticas. A opção -t coloca uma TLB
+   em cada núcleo. As opções -M, -L e -q definem a memória física, a memória lógica e o quantum, e -s uma lista
+   de tamanhos de página, com uma simulação por tamanho; -f lê esses valores de um arquivo de configuração.
+   A opção -c define o número de núcleos simulados, e -o o formato dos relatórios (texto, jsonl ou csv).
+   A opção -P limita os programas decodificados residentes; os demais são recarregados do arquivo quando executam.
+   A opção -T grava as transições de estado das tarefas de todas as simulações em um registro de execução no formato
+   JSON de eventos do Chrome, visualizado como um gráfico de Gantt em chrome://tracing ou no Perfetto.
+   A opção -k salva o estado completo da simulação em um arquivo binário, no instante informado ou ao receber o sinal
+   CHECKPOINT_SIGNAL, e a opção -R continua uma simulação a partir do estado salvo, com o mesmo resultado da execução
+   sem interrupção; as duas exigem uma única simulação, e a restauração, as mesmas tarefas e configuração, exceto o quantum.
+   No modo em lote, o estado é salvo apenas no instante informado.
+   A opção -b executa em paralelo os cenários de uma lista (-j define o número de threads).
+   Tarefas informadas com a extensão COMPILED_FILE_EXTENSION são carregadas pré-compiladas (ver 'tsmmCompile()').
+   A região é aplicada apenas às threads do programa (uselocale), sem alterar a região global do processo,
+   e nenhum erro encerra o processo: o código de saída é retornado ao chamador.
    Parâmetros:
-   - numberOfTasks: Número de tarefas a serem escalonadas.
-   - tasks: Array de strings contendo os nomes dos arquivos de tarefa.
+   - numberOfArguments: Número de argumentos do programa.
+   - arguments: Argumentos do programa (opções e nomes dos arquivos de tarefa).
    Retorno:
    - EXIT_SUCCESS se a execução for bem-sucedida, EXIT_FAILURE caso contrário.
 */
-int tsmm(int numberOfTasks, char *tasks[]) {
-    setlocale(LC_ALL, LOCALE);
-    if (!validateNumberOfArguments(numberOfTasks)) {
-        perror(INVALID_ARGUMENTS_ERROR);
-        exit(EXIT_FAILURE);
+int tsmm(int numberOfArguments, char *arguments[]) {
+    locale_t locale = newlocale(LC_ALL_MASK, LOCALE, (locale_t) 0);
+    locale_t previousLocale = (locale_t) 0;
+    if (locale != (locale_t) 0) {
+        previousLocale = uselocale(locale);
     }
-    RoundRobin roundRobin;
-    initializeRoundRobin(&roundRobin);
-    TaskDescriptor tasksDescriptions[numberOfTasks -1];
-    for (int i = 1; i < numberOfTasks; i++) {
-        if (!validateFile(tasks[i])) {
-            printf(DIVERGET_INSTRUCTION_ERROR, tasks[i]);
-            tasksDescriptions[i - 1].aborted = TRUE;
-            tasksDescriptions[i - 1].status = FINISHED;
+
+    Scenario scenario;
+    memset(&scenario, 0, sizeof(Scenario));
+    int result = parseScenario(&scenario, numberOfArguments, arguments, stdout);
+    if (result == EXIT_SUCCESS) {
+        if (scenario.batchFileName != NULL) {
+            result = runBatch(scenario.batchFileName, arguments[0], scenario.numberOfThreads, locale, scenario.reportFormat);
         }
         else {
-            initializeTaskDescriptor(&tasksDescriptions[i - 1], tasks[i]);
+            if (scenario.reportFormat->printHeader != NULL) {
+                scenario.reportFormat->printHeader(stdout);
+            }
+            result = runScenario(&scenario, stdout);
         }
     }
-    roundRobin = scheduleTasks(tasksDescriptions, numberOfTasks - 1);
-    printRoundRobin(roundRobin, numberOfTasksPerformedSuccessfully(tasksDescriptions, numberOfTasks -1));
-    printTasks(tasksDescriptions, numberOfTasks -1, roundRobin);
-    return EXIT_SUCCESS;
+    freeScenario(&scenario);
+
+    if (locale != (locale_t) 0) {
+        uselocale(previousLocale);
+        freelocale(locale);
+    }
+    return result;
 }//tsmm()
 
 int main(int argc, char *argv[]) {
+    // O buffer precisa ser estático: com NULL, a glibc ignora o tamanho pedido e usa o tamanho do bloco do arquivo.
+    static char outputBuffer[REPORT_BUFFER_SIZE];
+    setvbuf(stdout, outputBuffer, _IOFBF, sizeof(outputBuffer));
+
+    const char *programName = strrchr(argv[0], '/');
+    programName = programName != NULL ? programName + 1 : argv[0];
+    if (strcmp(programName, COMPILER_PROGRAM_NAME) == 0) {
+        return tsmmCompile(argc, argv);
+    }
+    if (strcmp(programName, BENCHMARK_PROGRAM_NAME) == 0) {
+        return tsmmBench(argc, argv);
+    }
     return tsmm(argc, argv);
 }//main()
\ No newline at end of file
@@ -1,5 +1,12 @@
 #pragma once
 
+#include <stdio.h>
+#include <limits.h>
+#include <stdint.h>
+#include <locale.h>
+#include <pthread.h>
+#include <signal.h>
+
 // Constantes lógicas.
 #define TRUE 1
 #define FALSE 0
@@ -7,11 +14,34 @@
 // Unidade de tempo: equivale à 1 instrução da tarefa.
 #define UT 1
 
-// Fatia de tempo (quantum) = 2ut (unidades de tempo).
-#define QUANTUM (2 * UT)
+// Fatia de tempo (quantum) padrão = 2ut (unidades de tempo), e o maior quantum aceito (-q).
+#define DEFAULT_QUANTUM (2 * UT)
+#define MAXIMUM_QUANTUM 1000000
+
+// Quantum das políticas não preemptivas: a tarefa executa até ser suspensa ou finalizada.
+#define NON_PREEMPTIVE_QUANTUM 0
+
+// Número de níveis da fila multinível com realimentação; o quantum dobra a cada nível.
+#define NUMBER_OF_FEEDBACK_LEVELS 3
+
+// Período (relógio do escalonador) em que todas as tarefas da fila multinível voltam ao primeiro nível.
+#define FEEDBACK_BOOST_PERIOD 50
+
+// Política de escalonamento padrão.
+#define DEFAULT_SCHEDULING_POLICY "rr"
+
+// Número padrão e máximo de núcleos de CPU simulados.
+#define DEFAULT_NUMBER_OF_CORES 1
+#define MAXIMUM_NUMBER_OF_CORES 64
+
+// Limite padrão de programas decodificados residentes (-P); 0 mantém todos os programas na memória.
+#define DEFAULT_RESIDENT_PROGRAMS 0
+
+// Separador da lista de políticas informada na linha de comando.
+#define POLICY_LIST_SEPARATOR ","
 
-// Define o número de tarefas realizadas pelo programa.
-#define NUMBER_OF_TASKS 4
+// Número de estados possíveis de uma tarefa (TaskStatus).
+#define NUMBER_OF_TASK_STATUS 4
 
 // Tempo de suspensão da tarefa
 #define SUSPENDED_TIME 5
@@ -19,41 +49,133 @@
 // Número máximo de instruções da tarefa.
 #define MAXIMUM_NUMBER_OF_INSTRUCTIONS 64
 
-// Número máximo de variaveis por tarefa
-#define MAXIMUN_NUMBER_OF_VARIABLES 10
+// Capacidade inicial do programa decodificado da tarefa (instruções e bytes de identificadores).
+#define INITIAL_PROGRAM_CAPACITY 16
+
+// Capacidade do primeiro bloco do registro de acessos à memória; cada novo bloco dobra, até o máximo.
+#define INITIAL_ACCESS_LOG_CHUNK_SIZE 16
+#define MAXIMUM_ACCESS_LOG_CHUNK_SIZE 4096
+
+// Capacidade inicial do vetor de variáveis da tarefa.
+#define INITIAL_VARIABLE_CAPACITY 8
+
+// Capacidade inicial (potência de dois) da tabela hash de símbolos do programa.
+#define INITIAL_SYMBOL_TABLE_CAPACITY 16
+
+// Símbolo ausente (instruções sem identificador) e variável não declarada.
+#define NO_SYMBOL UINT_MAX
+#define UNDECLARED_VARIABLE -1
+
+// Constantes do hash FNV-1a de 32 bits usado para internar os identificadores.
+#define FNV_OFFSET_BASIS 2166136261u
+#define FNV_PRIME 16777619u
+
+// Constantes do hash FNV-1a de 64 bits que confere a integridade do estado salvo da simulação.
+#define FNV64_OFFSET_BASIS 14695981039346656037ull
+#define FNV64_PRIME 1099511628211ull
 
 // Tamanho padrão de string.
 #define STRING_DEFAULT_SIZE 128
 
-// Tamanho do nome do arquivo.
-#define FILE_NAME_SIZE 64
+// Tamanho do nome do arquivo (caminhos vindos do manifesto ou do padrão glob).
+#define FILE_NAME_SIZE 1024
+
+// Capacidade inicial da lista de tarefas.
+#define INITIAL_TASK_LIST_CAPACITY 64
+
+// Capacidade inicial do heap de descritores de tarefa.
+#define INITIAL_HEAP_CAPACITY 16
 
-// Constantes para memória física e lógica
+// Constantes para memória física e lógica, valores padrão da geometria de memória (MachineConfiguration)
 // Total de memória física em bytes (64 KB)
-#define PHYSICAL_MEMORY_TOTAL 65536  
+#define DEFAULT_PHYSICAL_MEMORY_SIZE 65536  
 // Maior tamanho de memória lógica em bytes (4 KB)
-#define LARGEST_LOGICAL_MEMORY_SIZE 4096  
+#define DEFAULT_LOGICAL_MEMORY_SIZE 4096  
 
 
 // Tamanho de cada página lógica/física em bytes
-#define LOGICAL_PHYSICAL_PAGE_SIZE 512  
+#define DEFAULT_PAGE_SIZE 512  
 
 #define RESERVED_PROGRAM_MEMORY_SIZE 20480 
 
-// Padrões das instruções do arquivo
-#define INSTRUCTION_HEADER_REGEX "^#T=[0-9]+\\s*$"
-#define INSTRUCTION_NEW_REGEX "^[a-zA-Z_][a-zA-Z0-9_]*\\s+new\\s+[0-9]+\\s*$"
-#define INSTRUCTION_READ_DISK_REGEX "^read disk\\s*$"
-#define INSTRUCTION_IDEX_REGEX "^[a-zA-Z_][a-zA-Z0-9_]*\\s*\\[[0-9]+\\]\\s*$"
+// Limites da geometria de memória informada na execução.
+#define MINIMUM_PAGE_SIZE 16
+#define MAXIMUM_MEMORY_SIZE (1u << 30)
+#define MAXIMUM_NUMBER_OF_FRAMES 65536
+
+// Número máximo de tamanhos de página de uma varredura (-s).
+#define MAXIMUM_NUMBER_OF_PAGE_SIZES 16
+
+// Chaves do arquivo de configuração (-f), uma por linha seguida do valor.
+#define CONFIGURATION_PAGE_SIZE "pagina"
+#define CONFIGURATION_PHYSICAL_MEMORY "memoria_fisica"
+#define CONFIGURATION_LOGICAL_MEMORY "memoria_logica"
+#define CONFIGURATION_QUANTUM "quantum"
+
+// Indica que não há quadro livre ou que a página não está residente na memória física.
+#define NO_FRAME UINT_MAX
+
+// Número máximo de entradas da TLB de cada núcleo.
+#define MAXIMUM_TLB_ENTRIES 4096
+
+// Separador dos campos da configuração da TLB (entradas:vias:substituição:modo).
+#define TLB_CONFIGURATION_SEPARATOR ':'
+
+// Tempos, em nanossegundos, de uma consulta à TLB e de um acesso à memória, usados no tempo efetivo de acesso.
+// Uma falta na TLB consulta a tabela de páginas na memória antes do acesso.
+#define TLB_LOOKUP_TIME 20
+#define MEMORY_ACCESS_TIME 100
+
+// Padrões das instruções do arquivo, reconhecidos pelo analisador léxico de passagem única:
+//   cabeçalho:         #T=<bytes>
+//   new:               <identificador> new <bytes>
+//   acesso à memória:  <identificador>[<índice>]
+//   leitura de disco:  read disk
+#define INSTRUCTION_HEADER_PREFIX "#T="
+#define INSTRUCTION_NEW_KEYWORD "new"
+#define INSTRUCTION_READ_DISK "read disk"
 
 // Mensagens de erros
 #define DIVERGET_INSTRUCTION_ERROR "\nA tarefa %s não será executada, pois tem instruções diferentes do tipo 1, 2 e 3."
 #define INVALID_ARGUMENTS_ERROR "\nO Programa foi abortado, número de argumentos inválidos"
+#define USAGE_MESSAGE "\nUso: %s [-p política[,política...]] [-r substituição[,substituição...]] [-t entradas[:vias[:lru|fifo[:flush|asid]]]] [-s página[,página...]] [-M memória física] [-L memória lógica] [-q quantum] [-f configuração] [-c núcleos] [-P programas] [-T registro.json] [-k [instante:]estado] [-R estado] [-o formato] [-m manifesto] [-g padrão] [tarefa ...]\n     %s -b cenários [-j threads] [-o formato]\nPolíticas: rr, fcfs, sjf, srtf, priority, mlfq, fair\nSubstituição de páginas (paginação sob demanda): fifo, lru, clock, opt\nFormatos dos relatórios: texto, jsonl, csv\n"
+#define UNKNOWN_POLICY_ERROR "\nPolítica de escalonamento desconhecida: (%s)"
+#define UNKNOWN_REPLACEMENT_ERROR "\nPolítica de substituição de páginas desconhecida: (%s)"
+#define UNKNOWN_REPORT_FORMAT_ERROR "\nFormato de relatório desconhecido: (%s)"
+#define INVALID_CORES_ERROR "\nNúmero de núcleos inválido: (%s), use de 1 a %d"
+#define INVALID_RESIDENT_PROGRAMS_ERROR "\nLimite de programas residentes inválido: (%s)"
+#define SCHEDULER_MEMORY_ERROR "\nA tarefa %s foi abortada, pois não há memória para as estruturas do escalonador."
+#define PROGRAM_RELOAD_ERROR "\nA tarefa %s foi abortada, pois o seu arquivo mudou ou não pôde ser reaberto."
+#define INVALID_THREADS_ERROR "\nNúmero de threads inválido: (%s)"
+#define INVALID_MACHINE_VALUE_ERROR "\nValor inválido para %s: (%s)"
+#define INVALID_MACHINE_ERROR "\nGeometria de memória inválida: páginas de %u bytes, memória física de %u bytes e memória lógica de %u bytes; a memória física deve comportar as %u páginas de uma tarefa além dos quadros reservados, com até %d quadros"
+#define CONFIGURATION_OPEN_ERROR "\nFalha em abrir o arquivo de configuração: (%s)"
+#define CONFIGURATION_LINE_ERROR "\nLinha inválida no arquivo de configuração %s: (%s)"
+#define INVALID_TLB_ERROR "\nConfiguração da TLB inválida: (%s), use entradas[:vias[:lru|fifo[:flush|asid]]] com até %d entradas"
+#define TRACE_ERROR "\nFalha em gravar o registro de execução: (%s)"
+#define INVALID_CHECKPOINT_ERROR "\nEstado salvo inválido: (%s), use [instante:]arquivo"
+#define CHECKPOINT_SIMULATIONS_ERROR "\nAs opções -k e -R exigem uma única simulação: uma política de escalonamento, no máximo uma política de substituição de páginas e um tamanho de página"
+#define SNAPSHOT_SAVE_ERROR "\nFalha em gravar o estado da simulação: (%s)"
+#define SNAPSHOT_RESTORE_ERROR "\nFalha em restaurar o estado da simulação, o arquivo não pôde ser lido ou está corrompido: (%s)"
+#define SNAPSHOT_MISMATCH_ERROR "\nO estado salvo (%s) é de outra simulação: as tarefas e a configuração devem ser as mesmas, exceto o quantum"
+#define BATCH_OPEN_ERROR "\nFalha em abrir a lista de cenários: (%s)"
+#define BATCH_OUTPUT_ERROR "\nO Programa foi abortado, não há memória para os relatórios dos cenários"
+#define BATCH_SCENARIO_HEADER "\n\n# Cenário %d: %s\n"
+#define MANIFEST_OPEN_ERROR "\nFalha em abrir o manifesto de tarefas: (%s)"
+#define MANIFEST_LINE_ERROR "\nLinha inválida no manifesto de tarefas %s: (%s)"
+#define TASK_LIST_ERROR "\nO Programa foi abortado, não há memória para a lista de tarefas"
 #define MEMORY_ACCESS_ERROR "\nA tarefa %s foi abortada, pois tentou realizar um acesso inválido à memória: %s[%d]"
 #define UNDECLARED_IDENTIFIER_ERROR "\nA tarefa %s foi abortada, pois tentou acessar o identificador (%s) que não foi declarado."
 #define FILE_OPEN_ERROR "\nFalha em abrir o arquivo: (%s)"
+#define COMPILED_FILE_ERROR "\nArquivo compilado inválido ou de outra versão: (%s)"
+#define COMPILED_FILE_WRITE_ERROR "\nFalha em gravar o arquivo compilado: (%s)"
+#define COMPILER_USAGE_MESSAGE "\nUso: %s tarefa[.tsk] [tarefa[.tsk] ...]\nGera tarefa.tskb ao lado de cada arquivo de tarefa.\n"
+#define BENCHMARK_USAGE_MESSAGE "\nUso: %s [-n tarefas[,tarefas...]] [-i instruções] [-v variáveis] [-d leituras de disco (%%)] [-s semente] [-w diretório]\nSem -w, mede os componentes do simulador sobre cargas sintéticas, uma por contagem de tarefas;\ncom -w, grava a carga de uma única contagem de tarefas em arquivos .tsk.\n"
+#define WORKLOAD_WRITE_ERROR "\nFalha em gravar a carga de trabalho: (%s)"
+#define WORKLOAD_ERROR "\nO Programa foi abortado, não há memória para a carga de trabalho de %u tarefas"
+#define WORKLOAD_ABORTED_ERROR "\nO Programa foi abortado, %u de %u tarefas da carga de trabalho foram abortadas na simulação"
 #define IDENTIFY_ALREADY_DECLARED_ERROR "\nA tarefa %s foi abortada, pois tentou criar um identificador (%s) já declarado."
-#define ALLOCATION_SPACE_ERROR "\nA tarefa %s foi abortada, pois excedeu o tamanho maximo de alocação da memória reservada (%d) bytes"
+#define ALLOCATION_SPACE_ERROR "\nA tarefa %s foi abortada, pois excedeu o tamanho maximo de alocação da memória reservada (%u) bytes"
 
 // Representa um caractere nulo.
 #define NULL_CHAR '\0'
@@ -65,11 +187,86 @@
 // Extensão do arquivo
 #define FILE_EXTENSION ".tsk"
 
+// Arquivo de tarefa pré-compilado (.tskb), gerado por tsmm-compile: identificação, versão e marca da ordem dos bytes.
+#define COMPILED_FILE_EXTENSION ".tskb"
+#define COMPILED_FILE_MAGIC "TSKB"
+#define COMPILED_FILE_VERSION 1
+#define COMPILED_FILE_BYTE_ORDER 0x01020304u
+
+// Nome do programa (argv[0]) que executa o compilador de tarefas em vez do simulador.
+#define COMPILER_PROGRAM_NAME "tsmm-compile"
+
+// Nome do programa (argv[0]) que executa os microbenchmarks e o gerador de cargas de trabalho sintéticas.
+#define BENCHMARK_PROGRAM_NAME "tsmm-bench"
+
+// Carga de trabalho sintética padrão dos microbenchmarks: contagens de tarefas, instruções e variáveis por tarefa,
+// percentual de leituras de disco e semente.
+#define DEFAULT_WORKLOAD_TASK_COUNTS "4,100,1000,10000,100000"
+#define DEFAULT_WORKLOAD_INSTRUCTIONS 32
+#define DEFAULT_WORKLOAD_VARIABLES 4
+#define DEFAULT_WORKLOAD_DISK_PERCENT 10
+#define DEFAULT_WORKLOAD_SEED 1
+
+// Limites da carga de trabalho sintética; as variáveis de cada tarefa cabem na memória lógica padrão.
+#define MAXIMUM_WORKLOAD_TASKS 1000000
+#define MAXIMUM_WORKLOAD_INSTRUCTIONS (1u << 20)
+#define MAXIMUM_WORKLOAD_VARIABLES 1024
+#define MAXIMUM_WORKLOAD_TASK_COUNTS 16
+
+// Tamanho máximo de uma linha gerada (identificador, palavra-chave e dois números de 32 bits).
+#define WORKLOAD_LINE_SIZE 40
+
+// Nome dos arquivos de tarefa gravados no diretório da carga (-w); o índice com zeros mantém a ordem do padrão glob.
+#define WORKLOAD_FILE_NAME "%s/tarefa%06u" FILE_EXTENSION
+
+// Tempo mínimo, em nanossegundos, de cada medição; as repetições continuam até alcançá-lo.
+#define BENCHMARK_MINIMUM_TIME_NS 200000000.0
+
 // Região 
 #define LOCALE "pt_BR.utf8"
 
-// Opção de abertura do arquivo.
-#define FILE_OPENING_OPTION "r"
+// Tamanho do buffer da saída padrão: os relatórios são escritos em blocos grandes, e não linha a linha.
+#define REPORT_BUFFER_SIZE (1 << 20)
+
+// Formato padrão dos relatórios (-o).
+#define DEFAULT_REPORT_FORMAT "texto"
+
+// Colunas do formato CSV, uma linha por tarefa com a identificação da simulação.
+#define CSV_REPORT_HEADER "politica,substituicao,pagina,memoria_fisica,memoria_logica,quantum,nucleos,tlb_entradas,tarefa,abortada,tempo_cpu,tempo_es,inicio,fim,taxa_cpu,taxa_disco,paginas_logicas,faltas_pagina,acessos_memoria,tlb_acertos,tlb_faltas\n"
+
+// Tamanho do bloco de leitura usado quando o arquivo não pode ser mapeado em memória (pipes, FIFOs).
+#define BUFFERED_READ_SIZE 65536
+
+// Tamanho a partir do qual um arquivo compilado é mapeado em memória; os menores são lidos com uma única leitura,
+// que custa menos que o mapeamento e as faltas de página de um mapeamento mantido durante toda a simulação.
+#define COMPILED_MAPPING_THRESHOLD (256 * 1024)
+
+// Número de eventos acumulados pelo registro de execução (-T) antes de serem gravados em bloco no arquivo.
+#define TRACE_BUFFER_EVENTS 65536
+
+// Tamanho máximo do texto de um evento do registro de execução, com o nome da tarefa escapado na linha do núcleo.
+#define TRACE_LINE_SIZE 1024
+
+// Arquivo do estado salvo da simulação (-k e -R): identificação, versão e marca da ordem dos bytes, como no arquivo compilado.
+#define SNAPSHOT_MAGIC "TSMS"
+#define SNAPSHOT_VERSION 3
+#define SNAPSHOT_BYTE_ORDER 0x01020304u
+
+// Extensão do arquivo temporário em que o estado é gravado antes de substituir o estado salvo anterior.
+#define SNAPSHOT_TEMPORARY_EXTENSION ".tmp"
+
+// Tamanho dos blocos em que o estado salvo é lido, gravado e incluído no hash.
+#define SNAPSHOT_BUFFER_SIZE (1 << 20)
+
+// Referência a nenhuma tarefa no estado salvo.
+#define NO_TASK_REFERENCE UINT_MAX
+
+// Separador do instante e do arquivo do estado salvo (-k instante:arquivo).
+#define CHECKPOINT_TIME_SEPARATOR ':'
+
+// Sinal que pede para salvar o estado da simulação em andamento, e o instante usado quando o estado é salvo apenas pelo sinal.
+#define CHECKPOINT_SIGNAL SIGUSR1
+#define NO_CHECKPOINT_TIME UINT_MAX
 
 // Define uma string de tamanho padrão T, onde T é igual STRING_DEFAULT_SIZE.
 typedef char String[STRING_DEFAULT_SIZE];
@@ -90,99 +287,427 @@ typedef enum {
 
 // Instrução 
 typedef enum {
+    INVALID_INSTRUCTION = -1,
     HEADER, 
     NEW, 
     MEMORY_ACCESS, 
     READ_DISK
 } Instruction;
 
-// Representa a strutura da tarefa
-typedef struct  {
-   	// Número de instruções da tarefa.
-	unsigned short numberOfTaskInstructions;
+// Instrução decodificada pelo analisador léxico, com seus operandos.
+typedef struct {
+    // Tipo da instrução.
+    Instruction type;
+
+    // Identificador da variável (instruções new e acesso à memória), aponta para dentro da linha analisada.
+    const char *identifier;
+
+    // Tamanho do identificador em bytes.
+    unsigned int identifierLength;
 
+    // Bytes do cabeçalho, tamanho do new ou índice do acesso à memória.
+    unsigned int value;
+
+    // Índice do identificador na tabela de símbolos do programa, ou NO_SYMBOL (preenchido por fetchInstruction).
+    unsigned int symbol;
+} ParsedInstruction;
+
+// Instrução armazenada no programa da tarefa. O identificador é resolvido durante a carga
+// para o índice do seu símbolo, de modo que a execução não compara nomes.
+typedef struct {
+    Instruction type;
+    unsigned int value;
+    unsigned int symbol;
+} ProgramInstruction;
+
+// Identificador distinto do programa. Os bytes ficam no vetor de identificadores do programa,
+// referenciados por deslocamento para que o vetor possa crescer durante a carga.
+typedef struct {
+    unsigned int identifierOffset;
+    unsigned int identifierLength;
+    unsigned int hash;
+} Symbol;
+
+// Programa da tarefa: instruções decodificadas uma única vez durante a carga do arquivo.
+typedef struct {
+    // Instruções decodificadas.
+    ProgramInstruction *instructions;
+    unsigned int numberOfInstructions;
+    unsigned int instructionsCapacity;
+
+    // Bytes dos identificadores distintos (internados) referenciados pelas instruções.
+    char *identifiers;
+    unsigned int identifiersSize;
+    unsigned int identifiersCapacity;
+
+    // Tabela de símbolos: identificadores distintos, na ordem da primeira ocorrência.
+    Symbol *symbols;
+    unsigned int numberOfSymbols;
+    unsigned int symbolsCapacity;
+
+    // Tabela hash com endereçamento aberto: cada posição guarda o índice do símbolo mais um (0 = vazia).
+    unsigned int *symbolBuckets;
+    unsigned int numberOfBuckets;
+
+    // Imagem do arquivo compilado (.tskb), de onde as instruções, os símbolos e os identificadores são lidos
+    // diretamente: mapeada em memória ou lida para um único bloco do heap; NULL quando o programa foi decodificado do texto.
+    void *image;
+    size_t imageSize;
+    boolean imageMapped;
+} TaskProgram;
+
+// Cabeçalho do arquivo compilado (.tskb). Ele é seguido pelas instruções (ProgramInstruction), pelos símbolos (Symbol)
+// e pelos bytes dos identificadores, na ordem de bytes da máquina que o gerou.
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t byteOrder;
+
+    // Bytes do cabeçalho #T= da tarefa (a primeira instrução).
+    uint32_t headerSize;
+
+    uint32_t numberOfInstructions;
+    uint32_t numberOfSymbols;
+    uint32_t identifiersSize;
+    uint32_t reserved;
+} CompiledTaskHeader;
+
+// Representa a strutura da tarefa
+typedef struct Task {
 	// Nome da tarefa.
 	String nameOfTask;
 
-    // Ponteiro para a tarefa
-	FILE *taskFile;
+    // Programa decodificado da tarefa
+	TaskProgram program;
+
+    // Caminho do arquivo, usado para recarregar o programa descartado pelo conjunto de programas residentes.
+    const char *fileName;
+
+    // Quantidade de instruções e de símbolos do programa validado, conferidas a cada recarga.
+    unsigned int numberOfInstructions;
+    unsigned int numberOfSymbols;
+
+    // Conjunto de programas residentes e vizinhos na sua lista LRU; 'resident' indica se o programa está carregado.
+    struct ProgramPool *pool;
+    struct Task *moreRecent;
+    struct Task *lessRecent;
+    boolean resident;
 } Task;
 
+// Conjunto de programas residentes: limita quantos programas decodificados ficam na memória. Os programas
+// são descartados na ordem LRU e recarregados do arquivo quando a tarefa volta a executar, continuando do
+// seu contador de programa, de forma que a memória dos programas não cresce com o número de tarefas.
+typedef struct ProgramPool {
+    // Tarefas com programa residente, da usada mais recentemente à menos recente.
+    Task *mostRecent;
+    Task *leastRecent;
+    unsigned int residentPrograms;
+    unsigned int peakResidentPrograms;
+
+    // Limite de programas residentes, ou 0 para nunca descartar.
+    unsigned int capacity;
+
+    // Tarefa em execução, cujo programa nunca é descartado.
+    Task *pinned;
+
+    // Programas recarregados depois de descartados.
+    unsigned long long reloads;
+
+    // Saída das mensagens de erro das recargas.
+    FILE *output;
+} ProgramPool;
+
+// Representa uma unidade de tempo (UT), renomeada para dar mais sentido às variáveis da struct RoundRobin.
+typedef unsigned int TimeUnit;
+
 // Representa as memórias logugicas.
 typedef struct {
     unsigned int logicalInitialByte;
     unsigned int logicalFinalByte;
 } LogicalMemory;
 
-// Representa as memórias fisícas.
-typedef struct {
-    unsigned int physicalInitialByte;
-    unsigned int physicalFinalByte;
-} PhysicalMemory;
-
 // Estrutura para representar uma variavel da instrução new
 typedef struct {
     String name;
     unsigned int value;
 
     LogicalMemory logicalMemory;
-    PhysicalMemory physicalMemory;
 } Variable;
 
 // Estrutura que representa a páginação das páginas.
 typedef struct  {
    unsigned int bytesAllocated;
-   unsigned int physicalBytesAllocated; 
-   unsigned int initialBytesAllocated; 
    unsigned int finalPage;
+
+   // Tabela de páginas: quadro físico de cada página lógica mapeada, na ordem das páginas.
+   // Cresce com as páginas mapeadas, pois o número de páginas depende da geometria da execução.
+   unsigned int *frames;
+   unsigned int mappedPages;
+   unsigned int pageTableCapacity;
 } Pagination;
 
+// Geometria de memória e quantum de uma simulação, definidos por execução (-s, -M, -L, -q ou -f).
+typedef struct {
+    unsigned int pageSize;
+    unsigned int physicalMemorySize;
+    unsigned int logicalMemorySize;
+    TimeUnit quantum;
+
+    // Derivados por 'configureMachine()'. Tamanhos de página potência de dois traduzem por deslocamento e máscara.
+    boolean pageSizeIsPowerOfTwo;
+    unsigned int pageShift;
+    unsigned int pageMask;
+    unsigned int numberOfFrames;
+    unsigned int reservedFrames;
+
+    // Entradas da tabela de páginas de uma tarefa. As variáveis podem ocupar até o byte lógico
+    // logicalMemorySize, inclusive, que já pertence à página seguinte.
+    unsigned int maximumNumberOfPages;
+} MachineConfiguration;
+
+// Registro compacto de um acesso à memória: a variável é referenciada pelo índice, sem copiar o nome.
+typedef struct {
+    // Índice da variável acessada no vetor de variáveis da tarefa.
+    unsigned int variable;
+
+    // Deslocamento (índice) acessado dentro da variável.
+    unsigned int offset;
+
+    // Endereço físico traduzido no instante do acesso (a página pode mudar de quadro na paginação sob demanda).
+    unsigned int physicalAddress;
+
+    // Instante do acesso no relógio do escalonador.
+    TimeUnit timestamp;
+} MemoryAccessRecord;
 
+// Bloco do registro de acessos. Os blocos nunca são realocados: um novo bloco é encadeado quando o atual enche.
+typedef struct MemoryAccessChunk {
+    struct MemoryAccessChunk* next;
+    unsigned int size;
+    unsigned int capacity;
+    MemoryAccessRecord records[];
+} MemoryAccessChunk;
 
-// Representa o descritor da tarefa
+// Registro de acessos à memória da tarefa, sem limite de tamanho.
 typedef struct {
-    // Identificação da tarefa deste bloco de controle da tarefa.
-    Task task;
+    MemoryAccessChunk* head;
+    MemoryAccessChunk* tail;
+    unsigned long long numberOfAccesses;
+} MemoryAccessLog;
+
+
+
+// Dados de memória de uma tarefa, separados do descritor por serem usados apenas pelas instruções de memória
+// e pelos relatórios: ficam em um vetor paralelo ao dos descritores (TaskTable).
+typedef struct {
+    // Quantidade de váriaveis
+    unsigned int quantityVariables;
+
+    // Campo que representa a páginação
+    Pagination pagination;
+
+    // Faltas de página da tarefa (paginação sob demanda).
+    unsigned int pageFaults;
+
+    // Acertos e faltas na TLB nas traduções de endereço da tarefa.
+    unsigned long long tlbHits;
+    unsigned long long tlbMisses;
+
+    // Acessos a memoria
+    MemoryAccessLog accessLog;
+
+    // Variaveis da tarefa, na ordem de declaração.
+    Variable *variables;
+    unsigned int variablesCapacity;
+
+    // Índice em 'variables' da variável declarada para cada símbolo do programa, ou UNDECLARED_VARIABLE.
+    int *symbolVariables;
+} TaskMemory;
+
+// Representa o descritor da tarefa. O descritor guarda apenas o estado consultado pelo escalonador, de modo que
+// a tabela de descritores seja percorrida com poucas linhas de cache; o nome, o programa e os dados de memória
+// ficam em vetores paralelos (TaskTable).
+typedef struct TaskDescriptor {
+    // Campos lidos pelas filas e pelas comparações das políticas, agrupados nos primeiros 64 bytes.
+
+    // Próximo descritor na fila de tarefas prontas (lista intrusiva: a fila não aloca nós).
+    struct TaskDescriptor* next;
+
+    // Índice da próxima instrução do programa a ser executada e número de instruções do programa,
+    // copiado do programa para que as políticas comparem tarefas sem acessar a tabela de nomes e programas.
+    unsigned int programCounter;
+    unsigned int numberOfInstructions;
 
     // Indica o estado atual da tarefa. O estado da tarefa deve ser atualizado segundo o seu ciclo de vida durante sua execução. 
     TaskStatus status;
 
+    // Instante em que a tarefa suspensa pelo disco volta a ficar pronta; na espera por quadros livres, o instante
+    // da suspensão, antes do qual a tarefa não pode despertar.
+    TimeUnit wakeUpTime;
+
+    // Ordem da suspensão, usada para manter a ordem FIFO entre tarefas que despertam no mesmo instante.
+    unsigned long long wakeUpSequence;
+
+    // Ordem de entrada na estrutura de prontos, usada como critério de desempate das políticas com heap.
+    unsigned long long readySequence;
+
+    // Tempo virtual de CPU da política fair-share (cresce mais rápido para prioridades menores).
+    unsigned long long virtualRuntime;
+
+    // Prioridade estática (menor valor = maior prioridade), informada no manifesto.
+    int priority;
+
+    // Núcleo em que a tarefa executou por último; a tarefa volta para ele ao despertar (afinidade).
+    unsigned int core;
+
+    // Nível atual na fila multinível com realimentação e a época de reinício em que ele foi definido.
+    unsigned int feedbackLevel;
+    unsigned int feedbackEpoch;
+
+    // Identificação da tarefa deste bloco de controle da tarefa: nome e programa.
+    Task *task;
+
+    // Dados de memória da tarefa.
+    TaskMemory *memory;
+
     // Instante de tempo no qual a tarefa entrou na fila a primeira vez.
-    unsigned short startTime;
+    TimeUnit startTime;
 
-    // Instante de tempo no qual a tarefa foi finalizada.
-    unsigned short endTime;
+    // Instante de tempo no qual a tarefa foi finalizada, no relógio do núcleo que a finalizou.
+    TimeUnit endTime;
 
-    // Tempo de Cpu.
-    unsigned short cpuTime;
+    // Instante em que a tarefa ficou pronta pela última vez: na chegada, ao fim da fatia em que foi preemptada ou ao
+    // despertar. Nenhum núcleo a executa antes desse instante, mesmo que o seu relógio esteja atrasado.
+    TimeUnit readyTime;
 
-    // Variavel para controlar o tempo em que a terefa fica suspensa.
-    unsigned short suspendedTime;
+    // Tempo de Cpu.
+    TimeUnit cpuTime;
 
     // Variavel de controle para saber se a terafa foi abortada.
     boolean aborted;
 
     // Tempo de Entrada e Saida.
-    unsigned short inputOutputTime;
+    TimeUnit inputOutputTime;
 
-    // Quantidade de váriaveis
-    unsigned short quantityVariables;
+    // Indica se a tarefa já foi admitida na memória física, com os quadros do seu pico de uso reservados.
+    boolean memoryAdmitted;
 
-    // Quantidade de acessos
-    unsigned short quantityAccesses;
+    // Quadros reservados para a tarefa e ainda não mapeados.
+    unsigned int framesReserved;
 
-    // Campo que representa a páginação
-    Pagination pagination;
+    // Quadros que a tarefa espera para ser admitida na memória física, ou 0 se ela não espera por memória.
+    unsigned int framesWanted;
+} TaskDescriptor;
 
-    // Acessos a memoria
-    Variable accesses[MAXIMUN_NUMBER_OF_VARIABLES];
+// Tabela de tarefas de uma simulação: descritores, nomes e programas, e dados de memória em vetores paralelos,
+// com o mesmo índice para a mesma tarefa.
+typedef struct {
+    TaskDescriptor *descriptors;
+    Task *tasks;
+    TaskMemory *memories;
+    int numberOfTasks;
+} TaskTable;
 
-    // Variaveis da tarefa
-    Variable variable[MAXIMUN_NUMBER_OF_VARIABLES];
-} TaskDescriptor;
+// Estatísticas de um núcleo de CPU simulado.
+typedef struct {
+    // Tempo em que o núcleo executou instruções.
+    TimeUnit busyTime;
 
-// Representa uma unidade de tempo (UT), renomeada para dar mais sentido às variáveis da struct RoundRobin.
-typedef unsigned short int TimeUnit;
+    // Tempo em que o núcleo ficou ocioso.
+    TimeUnit idleTime;
+
+    // Número de vezes em que uma tarefa foi despachada para o núcleo.
+    unsigned int dispatches;
+
+    // Tarefas roubadas de outros núcleos por este núcleo.
+    unsigned int migrations;
+} CoreStatistics;
+
+// Quadro da memória física e a página de tarefa carregada nele.
+typedef struct {
+    // Tarefa dona da página, ou NULL se o quadro está livre.
+    struct TaskDescriptor* owner;
+
+    // Página lógica carregada no quadro.
+    unsigned int page;
+
+    // Instantes, contados em referências à memória, da carga e da última referência à página.
+    unsigned long long loadTime;
+    unsigned long long lastUse;
+
+    // Bit de referência da política do relógio (segunda chance).
+    boolean referenced;
+} PhysicalFrame;
+
+typedef struct FrameAllocator FrameAllocator;
+
+typedef struct EventTrace EventTrace;
+
+typedef struct Checkpoint Checkpoint;
+
+// Política de substituição de páginas da paginação sob demanda.
+typedef struct {
+    // Nome usado na linha de comando.
+    const char *name;
+
+    // Nome exibido no relatório.
+    const char *displayName;
+
+    // Escolhe, entre os quadros em uso, aquele cuja página será substituída.
+    unsigned int (*selectVictim)(FrameAllocator* allocator);
+} ReplacementPolicy;
+
+// Alocador dos quadros da memória física: mapa de bits com um bit por quadro (1 = livre).
+struct FrameAllocator {
+    unsigned long long *freeFrames;
+    unsigned int bitmapWords;
+
+    // Geometria da memória física: quadros reservados e total de quadros.
+    const MachineConfiguration* machine;
+
+    // Quantidade de quadros livres.
+    unsigned int numberOfFreeFrames;
+
+    // Quadros livres já reservados para tarefas admitidas.
+    unsigned int numberOfReservedFrames;
+
+    // Maior quantidade de quadros em uso ao mesmo tempo.
+    unsigned int peakFramesInUse;
+
+    // Política de substituição de páginas, ou NULL quando as páginas ficam residentes desde a alocação.
+    const ReplacementPolicy* replacement;
+
+    // Página carregada em cada quadro, com os dados usados pelas políticas de substituição.
+    PhysicalFrame *frames;
+
+    // Referências à memória realizadas, usadas como relógio das políticas FIFO e LRU.
+    unsigned long long references;
+
+    // Próximo quadro visitado pela política do relógio.
+    unsigned int clockHand;
+};
+
+// Política de substituição das entradas de um conjunto da TLB.
+typedef enum {
+    TLB_LRU,
+    TLB_FIFO
+} TlbReplacement;
+
+// Configuração da TLB de cada núcleo.
+typedef struct {
+    // Número de entradas, ou 0 para simular sem TLB.
+    unsigned int entries;
+
+    // Associatividade (vias por conjunto); igual ao número de entradas para uma TLB totalmente associativa.
+    unsigned int ways;
+
+    // Substituição dentro do conjunto.
+    TlbReplacement replacement;
+
+    // TRUE se as entradas são marcadas com o identificador da tarefa (ASID) e sobrevivem à troca de contexto;
+    // FALSE se a TLB é esvaziada a cada troca de contexto.
+    boolean asid;
+} TlbConfiguration;
 
 // Representa os dados coletados pelo escalonador Round-Robin, para calcular tempos médios após a execução dos programas.
 typedef struct {
@@ -192,360 +717,2380 @@ typedef struct {
     // Representa o total de entrada e saida
     TimeUnit totalOutputTime;
 
-    //Representa o tempo de espera
-    TimeUnit waitTime;
+    //Representa o tempo de espera (soma de todas as tarefas)
+    unsigned long long waitTime;
 
     // Representa o contador de preempção por tempo (Quantum)
     TimeUnit preemptionTimeCounter;
 
-} RoundRobin;
+    // Quantidade de tarefas em cada estado (indexado por TaskStatus), atualizada a cada transição.
+    unsigned int tasksPerStatus[NUMBER_OF_TASK_STATUS];
 
-// Definição da estrutura do nó da fila
-typedef struct TaskDescriptorNode {
-    TaskDescriptor* taskDescriptorPtr;
-    struct TaskDescriptorNode* next;
-} TaskDescriptorNode;
+    // Quantidade de tarefas abortadas.
+    unsigned int abortedTasks;
 
+    // Nome da política de escalonamento usada na execução.
+    const char *policyName;
 
-// Definição da estrutura da fila
-typedef struct {
-    TaskDescriptorNode* front; 
-    TaskDescriptorNode* rear; 
-} TaskDescriptorQueue;
+    // Número de núcleos simulados e o núcleo que está executando no momento.
+    unsigned int numberOfCores;
+    unsigned int currentCore;
 
-/* Cria uma nova fila de descritores de tarefa.
-   Aloca memória para a estrutura TaskDescriptorQueue e inicializa seus ponteiros front e rear como NULL,
-   indicando que a fila está vazia.
-   Retorna um ponteiro para a nova fila criada.
-*/
-TaskDescriptorQueue* createTaskDescriptorQueue();
+    // Estatísticas de cada núcleo.
+    CoreStatistics cores[MAXIMUM_NUMBER_OF_CORES];
 
-/* Verifica se a fila de descritores de tarefa está vazia.
-   Verifica se o ponteiro 'front' da fila passada como parâmetro é NULL,
-   indicando que não há nenhum elemento na fila.
-   Retorna TRUE se a fila estiver vazia, caso contrário retorna FALSE.
-*/
-boolean isTaskDescriptorQueueEmpty(TaskDescriptorQueue* queue);
+    // Total de migrações de tarefas entre núcleos (roubo de trabalho).
+    unsigned int migrations;
 
-/* Insere um descritor de tarefa na fila de descritores de tarefa.
-   Adiciona um novo nó contendo o descritor de tarefa fornecido à fila.
-   Se a fila estiver vazia, o novo nó é inserido como o primeiro e último elemento da fila.
-   Caso contrário, o novo nó é adicionado ao final da fila, atualizando o ponteiro 'rear'.
-   Parâmetros:
-   - queue: Ponteiro para a fila de descritores de tarefa.
-   - taskDescPtr: Ponteiro para o descritor de tarefa a ser inserido na fila.
-*/
-void enqueueTaskDescriptor(TaskDescriptorQueue* queue, TaskDescriptor* taskDescPtr);
+    // Saída dos relatórios e das mensagens da simulação.
+    FILE *output;
 
-/* Remove e retorna o descritor de tarefa no início da fila de descritores de tarefa.
-   Se a fila estiver vazia, retorna NULL, indicando que a fila está sem elementos.
-   Caso contrário, remove o primeiro elemento da fila, atualizando o ponteiro 'front'.
-   Parâmetros:
-   - queue: Ponteiro para a fila de descritores de tarefa.
-   Retorno:
-   - Ponteiro para o descritor de tarefa removido, ou NULL se a fila estiver vazia.
-*/
-TaskDescriptor* dequeueTaskDescriptor(TaskDescriptorQueue* queue);
+    // Tempo em que a CPU ficou ociosa (sem tarefa pronta ou após a suspensão da tarefa dentro do quantum).
+    TimeUnit idleTime;
 
-/* Destroi a fila de descritores de tarefa liberando toda a memória alocada.
-   Remove cada descritor de tarefa da fila usando a função 'dequeueTaskDescriptor()'
-   até que a fila esteja vazia e, em seguida, libera a memória da própria fila.
-   Parâmetros:
-   - queue: Ponteiro para a fila de descritores de tarefa a ser destruída.
-*/
-void destroyTaskDescriptorQueue(TaskDescriptorQueue* queue);
+    // Tempo total decorrido no relógio do escalonador.
+    TimeUnit elapsedTime;
 
-/* Verifica se todas as tarefas foram concluídas.
-   Percorre o vetor de descritores de tarefa verificando o status de cada uma.
-   Parâmetros:
-   - tasks: Array de descritores de tarefa.
-   - numberOfTasks: Número total de tarefas no array.
-   Retorno:
-   - TRUE se todas as tarefas estiverem marcadas como 'FINISHED', FALSE caso contrário.
-*/
-boolean allTasksFinished(TaskDescriptor tasks[], int numberOfTasks);
+    // Quadros da memória física, compartilhados pelas tarefas.
+    FrameAllocator frameAllocator;
 
-/* Simula a leitura do disco por uma tarefa.
-   Atualiza o status da tarefa para 'SUSPENDED' e adiciona o tempo de E/S ao tempo total de entrada/saída da tarefa.
-   Parâmetros:
-   - taskDescriptor: Ponteiro para o descritor de tarefa a ser modificado.
-*/
-void readDisk(TaskDescriptor* taskDescriptor);
+    // Vezes em que uma tarefa esperou por quadros livres.
+    unsigned int memoryWaits;
 
-/* Imprime os descritores das tarefas ativas.
-   Itera sobre as tarefas verificando se foram abortadas. Se não foram abortadas,
-   imprime o descritor da tarefa usando a função 'printTaskDescriptor'.
-   Parâmetros:
-   - tasks: Array de descritores de tarefa.
-   - numberOfTasks: Número total de tarefas no array.
-   - roundRobin: Estrutura RoundRobin contendo informações do sistema.
-*/
-void printTasks(TaskDescriptor tasks[], int numberOfTasks, RoundRobin roundRobin);
+    // Acessos à memória, faltas de página e substituições de página.
+    unsigned long long memoryAccesses;
+    unsigned long long pageFaults;
+    unsigned long long pageReplacements;
 
-/* Calcula a taxa de ocupação da CPU de uma tarefa.
-   Parâmetros:
-   - taskDesc: Descritor de tarefa (TaskDescriptor).
-   - roundRobin: Estrutura RoundRobin contendo informações do sistema.
-   Retorno:
-   - Taxa de ocupação da CPU (float).
-*/
-float calculateCPURate(TaskDescriptor taskDesc, RoundRobin roundRobin);
+    // Geometria de memória e quantum da simulação.
+    MachineConfiguration machine;
 
-/* Calcula a taxa de ocupação do disco de uma tarefa.
-   Parâmetros:
-   - taskDesc: Descritor de tarefa (TaskDescriptor).
-   - roundRobin: Estrutura RoundRobin contendo informações do sistema.
-   Retorno:
-   - Taxa de ocupação de disco (float).
-*/
-float calculateDiskRate(TaskDescriptor taskDesc, RoundRobin roundRobin) ;
+    // Configuração da TLB e os acertos, faltas e esvaziamentos somados em todos os núcleos.
+    TlbConfiguration tlb;
+    unsigned long long tlbHits;
+    unsigned long long tlbMisses;
+    unsigned long long tlbFlushes;
 
-/* Conta o número de tarefas executadas com sucesso.
-   Itera sobre as tarefas verificando se foram abortadas. Se uma tarefa não foi abortada,
-   incrementa o contador de tarefas executadas com sucesso.
-   Parâmetros:
-   - tasks: Array de descritores de tarefa.
-   - numberOfTasks: Número total de tarefas no array.
-   Retorno:
-   - Número de tarefas executadas com sucesso.
-*/
-int numberOfTasksPerformedSuccessfully(TaskDescriptor tasks[], int numberOfTasks);
+    // Limite de programas residentes (0 = sem limite), o pico de programas residentes e as recargas.
+    unsigned int residentProgramLimit;
+    unsigned int peakResidentPrograms;
+    unsigned long long programReloads;
 
-/* Imprime informações do Round-Robin.
-   Esta função imprime métricas do algoritmo Round-Robin, como o tempo médio de execução e o tempo médio de espera.
-   Utiliza o número de tarefas executadas com sucesso para calcular esses valores.
-   Parâmetros:
-   - roundRobin: Estrutura RoundRobin contendo informações do sistema.
-   - numberOfTasksPerformedSuccessfully: Número de tarefas executadas com sucesso.
-*/
-void printRoundRobin(RoundRobin roundRobin, int numberOfTasksPerformedSuccessfully);
+    // Registro de execução (-T), ou NULL; as transições de estado são registradas no relógio do núcleo em execução,
+    // lido no início da fatia, somado às unidades de tempo já consumidas na fatia.
+    EventTrace *trace;
+    TimeUnit coreClock;
 
-/* Imprime as informações de memória de uma variável da tarefa.
-   Parâmetros:
-   - var: Variável (Variable) da tarefa.
-*/
-void printVariableMemoryInfo(Variable var) ;
+    // Estado salvo durante a simulação (-k), ou NULL.
+    Checkpoint *checkpoint;
+} RoundRobin;
 
-/* Calcula e imprime as informações da tabela de páginas de uma tarefa.
-   Parâmetros:
-   - taskDesc: Descritor de tarefa (TaskDescriptor).
-*/
-void printPageTableInfo(TaskDescriptor taskDesc);
+// Definição da estrutura da fila. Os descritores são encadeados pelo campo 'next', portanto
+// um descritor pode estar em no máximo uma fila por vez.
+typedef struct {
+    TaskDescriptor* front; 
+    TaskDescriptor* rear; 
+} TaskDescriptorQueue;
 
-/* Imprime todas as informações de uma tarefa.
-   Parâmetros:
-   - taskDesc: Descritor de tarefa (TaskDescriptor).
-   - roundRobin: Estrutura RoundRobin contendo informações do sistema.
-*/
-void printTaskDescriptor(TaskDescriptor taskDesc, RoundRobin roundRobin);
+// Função de comparação do heap: retorna um valor negativo se 'a' deve sair do heap antes de 'b'.
+typedef int (*TaskDescriptorComparator)(const TaskDescriptor* a, const TaskDescriptor* b);
 
-/* Atualiza a memória lógica de uma variável de uma tarefa.
-   Esta função atualiza os endereços lógicos de uma variável da tarefa com base no valor alocado.
-   Calcula os endereços lógicos inicial e final, bem como atualiza a página final de paginação da tarefa.
-   Parâmetros:
-   - taskDescriptor: Ponteiro para o descritor de tarefa (TaskDescriptor).
-   - index: Índice da variável no array de variáveis da tarefa.
-   - value: Valor alocado para a variável.
-*/
-void updateLogicalMemory(TaskDescriptor* taskDescriptor, int index, int value);
+// Heap binário mínimo de descritores de tarefa, ordenado pela função de comparação.
+typedef struct {
+    TaskDescriptor** items;
+    int size;
+    int capacity;
+    TaskDescriptorComparator compare;
+} TaskDescriptorHeap;
 
-/* Atualiza a memória física de uma variável de uma tarefa.
-   Esta função atualiza os endereços físicos de uma variável da tarefa com base no valor alocado.
-   Calcula os endereços físicos inicial e final da variável.
-   Parâmetros:
-   - taskDescriptor: Ponteiro para o descritor de tarefa (TaskDescriptor).
+typedef struct Scheduler Scheduler;
+
+// Entrada da TLB: tradução de uma página de tarefa para o seu quadro.
+typedef struct {
+    // Tarefa dona da página, que serve de identificador de espaço de endereçamento (ASID).
+    const struct TaskDescriptor* task;
+
+    // Página lógica e quadro físico.
+    unsigned int page;
+    unsigned int frame;
+
+    // Instantes, contados em consultas à TLB, da inserção e do último uso da entrada.
+    unsigned long long insertedAt;
+    unsigned long long lastUse;
+
+    boolean valid;
+} TlbEntry;
+
+// TLB de um núcleo, organizada em conjuntos de 'ways' entradas consecutivas.
+typedef struct {
+    TlbEntry* entries;
+
+    // Consultas realizadas, usadas como relógio das substituições.
+    unsigned long long lookups;
+
+    // Última tarefa executada no núcleo, para detectar a troca de contexto.
+    const struct TaskDescriptor* lastTask;
+} Tlb;
+
+// Núcleo de CPU simulado, com a sua própria estrutura de tarefas prontas.
+typedef struct {
+    // Filas FIFO das tarefas prontas (Round-Robin e FCFS usam apenas o primeiro nível).
+    TaskDescriptorQueue* readyQueues[NUMBER_OF_FEEDBACK_LEVELS];
+
+    // Heap de tarefas prontas das políticas SJF, SRTF, prioridade e fair-share.
+    TaskDescriptorHeap* readyHeap;
+
+    // Número de tarefas prontas no núcleo, usado para escolher de qual núcleo roubar trabalho.
+    unsigned int numberOfReadyTasks;
+
+    // Relógio local do núcleo.
+    TimeUnit clock;
+
+    // TLB do núcleo (sem entradas quando a simulação não usa TLB).
+    Tlb tlb;
+} Core;
+
+// Interface de uma política de escalonamento. O escalonador chama os ganchos a cada transição da tarefa
+// e a política decide, com a estrutura de dados adequada, qual tarefa pronta executa em seguida.
+typedef struct {
+    // Nome usado na linha de comando.
+    const char *name;
+
+    // Nome exibido no relatório.
+    const char *displayName;
+
+    // Ordem do heap de prontos, ou NULL para as políticas que usam filas FIFO.
+    TaskDescriptorComparator compare;
+
+    // Retira a próxima tarefa a executar no núcleo, ou NULL se não houver tarefas prontas.
+    TaskDescriptor* (*pickNext)(Scheduler* scheduler, Core* core);
+
+    // Admite uma tarefa pela primeira vez. Este gancho, 'onPreempt' e 'onWake' retornam FALSE se não houver memória
+    // para colocar a tarefa na estrutura de prontos.
+    boolean (*onArrive)(Scheduler* scheduler, Core* core, TaskDescriptor* taskDescriptor);
+
+    // Devolve uma tarefa que esgotou seu quantum e continua pronta.
+    boolean (*onPreempt)(Scheduler* scheduler, Core* core, TaskDescriptor* taskDescriptor, TimeUnit ran);
+
+    // Notifica que a tarefa saiu da CPU por ter sido suspensa.
+    void (*onBlock)(Scheduler* scheduler, TaskDescriptor* taskDescriptor, TimeUnit ran);
+
+    // Devolve uma tarefa suspensa que voltou a ficar pronta.
+    boolean (*onWake)(Scheduler* scheduler, Core* core, TaskDescriptor* taskDescriptor);
+
+    // Quantum concedido à tarefa, ou NON_PREEMPTIVE_QUANTUM.
+    TimeUnit (*quantum)(Scheduler* scheduler, TaskDescriptor* taskDescriptor);
+} SchedulingPolicy;
+
+// Estado do escalonador: núcleos com as estruturas de prontos da política e fila de despertar das tarefas suspensas.
+struct Scheduler {
+    // Política de escalonamento.
+    const SchedulingPolicy* policy;
+
+    // Núcleos simulados.
+    Core cores[MAXIMUM_NUMBER_OF_CORES];
+    unsigned int numberOfCores;
+
+    // Número de entradas na estrutura de prontos, usado como critério de desempate.
+    unsigned long long readySequence;
+
+    // Quantum base das políticas preemptivas.
+    TimeUnit quantum;
+
+    // Época atual da fila multinível e instante do próximo reinício dos níveis.
+    unsigned int feedbackEpoch;
+    TimeUnit nextFeedbackBoost;
+
+    // Menor tempo virtual entre as tarefas da política fair-share.
+    unsigned long long minVirtualRuntime;
+
+    // Tarefas suspensas ordenadas pelo instante absoluto de despertar.
+    TaskDescriptorHeap* wakeUpQueue;
+
+    // Tarefas suspensas à espera de quadros livres, em ordem de chegada.
+    TaskDescriptorQueue* memoryWaitQueue;
+
+    // Relógio global: relógio local do núcleo que está escalonando, usado para calcular o instante de despertar.
+    TimeUnit clock;
+
+    // Número de suspensões realizadas, usado como critério de desempate da fila de despertar.
+    unsigned long long suspensions;
+
+    // Índice da próxima tarefa a chegar; a tarefa i chega no instante i.
+    int nextArrival;
+};
+
+// Número de políticas de escalonamento disponíveis.
+#define NUMBER_OF_SCHEDULING_POLICIES 7
+
+// Políticas de escalonamento disponíveis (rr, fcfs, sjf, srtf, priority, mlfq, fair).
+extern const SchedulingPolicy SCHEDULING_POLICIES[NUMBER_OF_SCHEDULING_POLICIES];
+
+// Número de políticas de substituição de páginas disponíveis.
+#define NUMBER_OF_REPLACEMENT_POLICIES 4
+
+// Políticas de substituição de páginas disponíveis (fifo, lru, clock, opt).
+extern const ReplacementPolicy REPLACEMENT_POLICIES[NUMBER_OF_REPLACEMENT_POLICIES];
+
+// Formato dos relatórios. As funções recebem a simulação por ponteiro constante e escrevem na saída informada.
+typedef struct {
+    // Nome usado na linha de comando.
+    const char *name;
+
+    // Indica um formato lido por programas: as mensagens de erro das tarefas vão para a saída de erros.
+    boolean machineReadable;
+
+    // Imprime o cabeçalho da saída, uma única vez antes do primeiro relatório, ou NULL se não houver.
+    void (*printHeader)(FILE *output);
+
+    // Imprime a identificação de um cenário do modo em lote, ou NULL se o formato não a usa.
+    void (*printScenarioHeader)(FILE *output, int number, const char *description);
+
+    // Imprime o relatório de uma simulação.
+    void (*printReport)(FILE *output, const RoundRobin* roundRobin, const TaskDescriptor tasks[], int numberOfTasks);
+} ReportFormat;
+
+// Número de formatos de relatório disponíveis.
+#define NUMBER_OF_REPORT_FORMATS 3
+
+// Formatos de relatório disponíveis (texto, jsonl, csv).
+extern const ReportFormat REPORT_FORMATS[NUMBER_OF_REPORT_FORMATS];
+
+// Lista dinâmica com os nomes das tarefas (argumentos, manifesto ou padrão glob).
+typedef struct {
+    char **names;
+    int *priorities;
+    int numberOfTasks;
+    int capacity;
+} TaskList;
+
+// Intervalo em que uma tarefa permaneceu em um estado, ou o instante em que ela terminou (estado FINISHED).
+typedef struct {
+    TimeUnit start;
+    TimeUnit duration;
+    unsigned int task;
+    unsigned int core;
+    TaskStatus status;
+    boolean aborted;
+} TraceEvent;
+
+// Arquivo do registro de execução (-T) de um cenário, no formato JSON de eventos do Chrome (chrome://tracing, Perfetto).
+// Cada simulação do cenário é um processo do arquivo.
+typedef struct {
+    const char *fileName;
+    FILE *output;
+    unsigned int numberOfProcesses;
+} TraceFile;
+
+// Registro de execução de uma simulação: os eventos são acumulados em um buffer alocado uma única vez e gravados
+// em bloco quando ele enche e ao final da simulação.
+struct EventTrace {
+    TraceFile *file;
+    unsigned int process;
+
+    // Tarefas da simulação (o índice da tarefa identifica a sua linha no registro) e o instante da última transição
+    // de cada tarefa.
+    const TaskDescriptor *tasks;
+    int numberOfTasks;
+    TimeUnit *since;
+
+    TraceEvent *events;
+    unsigned int numberOfEvents;
+};
+
+// Nomes dos estados das tarefas no registro de execução, indexados por TaskStatus.
+extern const char *const TRACE_STATUS_NAMES[NUMBER_OF_TASK_STATUS];
+
+// Estado salvo (-k) e restaurado (-R) de uma simulação. O estado é salvo entre dois passos do escalonamento, no primeiro
+// passo em que o relógio do núcleo escalonado alcança o instante pedido, ou no passo seguinte ao sinal CHECKPOINT_SIGNAL.
+struct Checkpoint {
+    // Arquivo em que o estado é salvo, ou NULL, e o instante, ou NO_CHECKPOINT_TIME para salvar apenas ao receber o sinal.
+    const char *saveFileName;
+    TimeUnit saveTime;
+
+    // Indica que o sinal pede o estado; só fora do modo em lote, onde os cenários executam em paralelo.
+    boolean followsSignal;
+
+    // Arquivo do estado restaurado no lugar da admissão das tarefas, ou NULL.
+    const char *restoreFileName;
+
+    // Conjunto de programas residentes da simulação, salvo com o estado, e a saída das mensagens de erro.
+    ProgramPool *pool;
+    FILE *output;
+
+    // Indicam que a restauração falhou, e a simulação não foi executada, ou que alguma gravação do estado falhou.
+    boolean restoreFailed;
+    boolean saveFailed;
+};
+
+// Arquivo do estado salvo aberto para gravação ou para leitura: as mesmas funções descrevem o formato nos dois sentidos.
+// Os campos são gravados um a um, sem os ponteiros, na ordem de bytes da máquina; as tarefas são referenciadas pelo índice.
+typedef struct {
+    FILE *file;
+    boolean restoring;
+
+    // Bloco de SNAPSHOT_BUFFER_SIZE bytes de onde os campos são copiados ou para onde são copiados, a posição do próximo
+    // campo e, na leitura, a quantidade de bytes lidos no bloco. O arquivo só é acessado em blocos inteiros.
+    unsigned char *block;
+    size_t position;
+    size_t length;
+
+    // Falha de leitura, de gravação ou de memória, e estado salvo de outra simulação.
+    boolean failed;
+    boolean mismatched;
+
+    // Hash dos blocos gravados, anexado ao final do arquivo.
+    uint64_t checksum;
+} SnapshotStream;
+
+// Grava ou lê um campo do estado salvo, com o tamanho que ele tem na máquina.
+#define TRANSFER_SNAPSHOT(stream, field) transferSnapshotBytes(stream, &(field), sizeof(field))
+
+// Pedido de salvar o estado, feito pelo sinal CHECKPOINT_SIGNAL e atendido pela simulação com -k em andamento.
+extern volatile sig_atomic_t checkpointRequested;
+
+// Cenário de simulação: carga de trabalho e parâmetros lidos da linha de comando ou de uma linha da lista de cenários.
+typedef struct {
+    // Tarefas a serem escalonadas.
+    TaskList taskList;
+
+    // Políticas de escalonamento, executadas em sequência sobre a mesma carga de trabalho.
+    const SchedulingPolicy* policies[NUMBER_OF_SCHEDULING_POLICIES];
+    int numberOfPolicies;
+
+    // Políticas de substituição de páginas (-r); sem nenhuma, as páginas ficam residentes desde a alocação.
+    const ReplacementPolicy* replacements[NUMBER_OF_REPLACEMENT_POLICIES];
+    int numberOfReplacements;
+
+    // Número de núcleos simulados.
+    unsigned int numberOfCores;
+
+    // Limite de programas decodificados residentes (-P), ou 0 para manter todos.
+    unsigned int residentPrograms;
+
+    // Configuração da TLB (-t); sem ela, as traduções não passam por uma TLB.
+    TlbConfiguration tlb;
+
+    // Geometria de memória e quantum (-M, -L, -q ou -f) e os tamanhos de página (-s), uma simulação por tamanho.
+    MachineConfiguration machine;
+    unsigned int pageSizes[MAXIMUM_NUMBER_OF_PAGE_SIZES];
+    int numberOfPageSizes;
+
+    // Formato dos relatórios (-o).
+    const ReportFormat* reportFormat;
+
+    // Arquivo do registro de execução (-T), ou NULL para não registrar.
+    char *traceFileName;
+    TraceFile trace;
+
+    // Arquivo em que o estado da simulação é salvo (-k) e o instante, e arquivo do estado restaurado (-R), ou NULL.
+    char *checkpointFileName;
+    TimeUnit checkpointTime;
+    char *restoreFileName;
+
+    // Lista de cenários (-b) e número de threads (-j) do modo em lote; NULL e 0 fora dele.
+    const char *batchFileName;
+    int numberOfThreads;
+
+    // Linha da lista de cenários, usada no cabeçalho do relatório do modo em lote.
+    char *description;
+
+    // Relatório do cenário no modo em lote, acumulado em memória para não intercalar a saída das threads.
+    FILE *output;
+    char *report;
+    size_t reportSize;
+
+    // EXIT_SUCCESS ou EXIT_FAILURE.
+    int result;
+} Scenario;
+
+// Especificação de uma carga de trabalho sintética: a mesma especificação gera sempre os mesmos programas.
+typedef struct {
+    // Número de tarefas e, em cada tarefa, de instruções após o cabeçalho e as declarações.
+    unsigned int numberOfTasks;
+    unsigned int numberOfInstructions;
+
+    // Variáveis declaradas (new) no início de cada tarefa e acessadas em posições aleatórias.
+    unsigned int numberOfVariables;
+
+    // Percentual das instruções que são leituras de disco; as demais são acessos à memória.
+    unsigned int diskReadPercent;
+
+    // Semente do gerador pseudoaleatório.
+    uint64_t seed;
+} WorkloadSpec;
+
+// Carga de trabalho sintética mantida em memória, com o texto de cada tarefa, usada pelos microbenchmarks.
+typedef struct {
+    WorkloadSpec spec;
+    char **sources;
+    size_t *sizes;
+
+    // Total de linhas (instruções) de todas as tarefas.
+    unsigned long long numberOfLines;
+} Workload;
+
+// Instrumentação dos pontos quentes, ativada ao compilar com -DTSMM_INSTRUMENTATION. Sem ela, as macros
+// INSTRUMENTATION_* não geram código e as funções e estruturas abaixo não existem.
+#ifdef TSMM_INSTRUMENTATION
+
+// Trechos medidos com o relógio monotônico.
+typedef enum {
+    TIMER_VALIDATE_FILE,
+    TIMER_DETERMINE_INSTRUCTION,
+    TIMER_EXECUTE_INSTRUCTION,
+    TIMER_SUSPENDED_TASKS,
+    TIMER_PRINT_REPORT,
+    NUMBER_OF_INSTRUMENTATION_TIMERS
+} InstrumentationTimer;
+
+// Eventos contados.
+typedef enum {
+    COUNTER_CONTEXT_SWITCHES,
+    COUNTER_ENQUEUES,
+    COUNTER_DEQUEUES,
+    COUNTER_IO_SUSPENSIONS,
+    NUMBER_OF_INSTRUMENTATION_COUNTERS
+} InstrumentationCounter;
+
+// Tempos e contagens de uma simulação.
+typedef struct {
+    unsigned long long calls[NUMBER_OF_INSTRUMENTATION_TIMERS];
+    double nanoseconds[NUMBER_OF_INSTRUMENTATION_TIMERS];
+    unsigned long long counters[NUMBER_OF_INSTRUMENTATION_COUNTERS];
+} Instrumentation;
+
+// Nomes dos trechos medidos e dos eventos contados, na ordem das enumerações.
+extern const char *const INSTRUMENTATION_TIMER_NAMES[NUMBER_OF_INSTRUMENTATION_TIMERS];
+extern const char *const INSTRUMENTATION_COUNTER_NAMES[NUMBER_OF_INSTRUMENTATION_COUNTERS];
+
+// Medições da simulação em andamento. Cada thread tem as suas, pois uma simulação executa inteira em uma thread
+// e os cenários do modo em lote executam em paralelo.
+extern _Thread_local Instrumentation instrumentation;
+
+#define INSTRUMENTATION_START(start) struct timespec start; clock_gettime(CLOCK_MONOTONIC, &start)
+#define INSTRUMENTATION_STOP(start, timer) stopInstrumentationTimer(timer, &start)
+#define INSTRUMENTATION_COUNT(counter) (instrumentation.counters[counter]++)
+#define INSTRUMENTATION_RESET() memset(&instrumentation, 0, sizeof(Instrumentation))
+#define INSTRUMENTATION_PRINT(output) printInstrumentation(output)
+
+#else
+
+#define INSTRUMENTATION_START(start)
+#define INSTRUMENTATION_STOP(start, timer)
+#define INSTRUMENTATION_COUNT(counter)
+#define INSTRUMENTATION_RESET()
+#define INSTRUMENTATION_PRINT(output)
+
+#endif
+
+// Fila de cenários compartilhada pelas threads do modo em lote.
+typedef struct {
+    Scenario *scenarios;
+    int numberOfScenarios;
+
+    // Próximo cenário a ser executado, protegido por lock.
+    int next;
+    pthread_mutex_t lock;
+
+    // Região (locale) usada por todas as threads, sem alterar a região global do processo.
+    locale_t locale;
+} ScenarioQueue;
+
+/* Cria uma nova fila de descritores de tarefa.
+   Aloca memória para a estrutura TaskDescriptorQueue e inicializa seus ponteiros front e rear como NULL,
+   indicando que a fila está vazia.
+   Retorna um ponteiro para a nova fila criada.
+*/
+TaskDescriptorQueue* createTaskDescriptorQueue();
+
+/* Verifica se a fila de descritores de tarefa está vazia.
+   Verifica se o ponteiro 'front' da fila passada como parâmetro é NULL,
+   indicando que não há nenhum elemento na fila.
+   Retorna TRUE se a fila estiver vazia, caso contrário retorna FALSE.
+*/
+boolean isTaskDescriptorQueueEmpty(TaskDescriptorQueue* queue);
+
+/* Insere um descritor de tarefa na fila de descritores de tarefa.
+   Encadeia o descritor fornecido ao final da fila pelo seu campo 'next', sem alocar memória.
+   Se a fila estiver vazia, o descritor é inserido como o primeiro e último elemento da fila.
+   Caso contrário, o descritor é adicionado ao final da fila, atualizando o ponteiro 'rear'.
+   Parâmetros:
+   - queue: Ponteiro para a fila de descritores de tarefa.
+   - taskDescPtr: Ponteiro para o descritor de tarefa a ser inserido na fila.
+*/
+void enqueueTaskDescriptor(TaskDescriptorQueue* queue, TaskDescriptor* taskDescPtr);
+
+/* Remove e retorna o descritor de tarefa no início da fila de descritores de tarefa.
+   Se a fila estiver vazia, retorna NULL, indicando que a fila está sem elementos.
+   Caso contrário, desencadeia o primeiro elemento da fila, atualizando o ponteiro 'front', sem liberar memória.
+   Parâmetros:
+   - queue: Ponteiro para a fila de descritores de tarefa.
+   Retorno:
+   - Ponteiro para o descritor de tarefa removido, ou NULL se a fila estiver vazia.
+*/
+TaskDescriptor* dequeueTaskDescriptor(TaskDescriptorQueue* queue);
+
+/* Move todos os descritores de uma fila para o final de outra, em tempo constante.
+   Parâmetros:
+   - destination: Fila que recebe os descritores.
+   - source: Fila cujos descritores são movidos; fica vazia.
+*/
+void appendTaskDescriptorQueue(TaskDescriptorQueue* destination, TaskDescriptorQueue* source);
+
+/* Destroi a fila de descritores de tarefa liberando toda a memória alocada.
+   Remove cada descritor de tarefa da fila usando a função 'dequeueTaskDescriptor()'
+   até que a fila esteja vazia e, em seguida, libera a memória da própria fila.
+   Os descritores não são liberados, pois pertencem à tabela de tarefas.
+   Parâmetros:
+   - queue: Ponteiro para a fila de descritores de tarefa a ser destruída.
+*/
+void destroyTaskDescriptorQueue(TaskDescriptorQueue* queue);
+
+/* Cria um novo heap de descritores de tarefa.
+   Parâmetros:
+   - compare: Função que define a ordem de saída dos descritores.
+   Retorno:
+   - Ponteiro para o heap criado, vazio.
+*/
+TaskDescriptorHeap* createTaskDescriptorHeap(TaskDescriptorComparator compare);
+
+/* Verifica se o heap de descritores de tarefa está vazio.
+   Retorna TRUE se o heap estiver vazio, caso contrário retorna FALSE.
+*/
+boolean isTaskDescriptorHeapEmpty(TaskDescriptorHeap* heap);
+
+/* Insere um descritor de tarefa no heap, em O(log n).
+   Parâmetros:
+   - heap: Ponteiro para o heap de descritores de tarefa.
+   - taskDescPtr: Ponteiro para o descritor de tarefa a ser inserido.
+   Retorno:
+   - TRUE se o descritor foi inserido, FALSE se não houve memória para aumentar o heap, que continua como estava.
+*/
+boolean pushTaskDescriptor(TaskDescriptorHeap* heap, TaskDescriptor* taskDescPtr);
+
+/* Retorna o descritor de tarefa do topo do heap, sem removê-lo.
+   Retorno:
+   - Ponteiro para o menor descritor do heap, ou NULL se o heap estiver vazio.
+*/
+TaskDescriptor* peekTaskDescriptor(TaskDescriptorHeap* heap);
+
+/* Remove e retorna o descritor de tarefa do topo do heap, em O(log n).
+   Parâmetros:
+   - heap: Ponteiro para o heap de descritores de tarefa.
+   Retorno:
+   - Ponteiro para o menor descritor do heap, ou NULL se o heap estiver vazio.
+*/
+TaskDescriptor* popTaskDescriptor(TaskDescriptorHeap* heap);
+
+/* Destroi o heap de descritores de tarefa liberando toda a memória alocada.
+   Os descritores apontados pelo heap não são liberados.
+   Parâmetros:
+   - heap: Ponteiro para o heap a ser destruído.
+*/
+void destroyTaskDescriptorHeap(TaskDescriptorHeap* heap);
+
+/* Compara duas tarefas suspensas pelo instante de despertar.
+   Tarefas que despertam no mesmo instante são ordenadas pela ordem de suspensão (FIFO).
+   Retorno:
+   - Valor negativo se 'a' desperta antes de 'b', positivo se depois.
+*/
+int compareWakeUpTime(const TaskDescriptor* a, const TaskDescriptor* b);
+
+/* Inicializa o estado do escalonador.
+   Cria, para cada núcleo, as estruturas de prontos da política e a TLB, cria a fila de despertar das tarefas
+   suspensas e a fila de espera por memória, e zera os relógios.
+   Parâmetros:
+   - scheduler: Ponteiro para o escalonador a ser inicializado.
+   - policy: Política de escalonamento.
+   - numberOfCores: Número de núcleos simulados.
+   - tlb: Configuração da TLB dos núcleos.
+*/
+void initializeScheduler(Scheduler* scheduler, const SchedulingPolicy* policy, unsigned int numberOfCores, const TlbConfiguration* tlb);
+
+/* Libera a memória das filas do escalonador.
+   Parâmetros:
+   - scheduler: Ponteiro para o escalonador.
+*/
+void destroyScheduler(Scheduler* scheduler);
+
+/* Desempata tarefas com a mesma chave pela ordem de entrada na estrutura de prontos (FIFO).
+*/
+int compareReadySequence(const TaskDescriptor* a, const TaskDescriptor* b);
+
+/* Compara duas tarefas pelo tamanho total do programa (SJF).
+*/
+int compareJobLength(const TaskDescriptor* a, const TaskDescriptor* b);
+
+/* Compara duas tarefas pela quantidade de instruções restantes (SRTF).
+*/
+int compareRemainingTime(const TaskDescriptor* a, const TaskDescriptor* b);
+
+/* Compara duas tarefas pela prioridade estática (menor valor = maior prioridade).
+*/
+int comparePriority(const TaskDescriptor* a, const TaskDescriptor* b);
+
+/* Compara duas tarefas pelo tempo virtual de CPU (fair-share).
+*/
+int compareVirtualRuntime(const TaskDescriptor* a, const TaskDescriptor* b);
+
+/* Coloca uma tarefa no final da fila FIFO de prontos (Round-Robin e FCFS).
+*/
+boolean enqueueReadyTask(Scheduler* scheduler, Core* core, TaskDescriptor* taskDescriptor);
+
+/* Retira a tarefa do início da fila FIFO de prontos (Round-Robin e FCFS).
+*/
+TaskDescriptor* pickFirstReadyTask(Scheduler* scheduler, Core* core);
+
+/* Devolve à fila FIFO uma tarefa que esgotou seu quantum.
+*/
+boolean preemptToReadyQueue(Scheduler* scheduler, Core* core, TaskDescriptor* taskDescriptor, TimeUnit ran);
+
+/* Gancho vazio para as políticas que não reagem à suspensão da tarefa.
+*/
+void ignoreBlockedTask(Scheduler* scheduler, TaskDescriptor* taskDescriptor, TimeUnit ran);
+
+/* Quantum fixo do Round-Robin e das políticas preemptivas por fatia de tempo.
+*/
+TimeUnit fixedQuantum(Scheduler* scheduler, TaskDescriptor* taskDescriptor);
+
+/* Quantum das políticas não preemptivas (FCFS e SJF).
+*/
+TimeUnit nonPreemptiveQuantum(Scheduler* scheduler, TaskDescriptor* taskDescriptor);
+
+/* Quantum do SRTF: uma instrução, para que a tarefa com menos instruções restantes seja reavaliada a cada passo.
+*/
+TimeUnit singleInstructionQuantum(Scheduler* scheduler, TaskDescriptor* taskDescriptor);
+
+/* Coloca uma tarefa no heap de prontos, registrando sua ordem de entrada.
+*/
+boolean pushReadyTask(Scheduler* scheduler, Core* core, TaskDescriptor* taskDescriptor);
+
+/* Retira a tarefa do topo do heap de prontos.
+*/
+TaskDescriptor* pickTopReadyTask(Scheduler* scheduler, Core* core);
+
+/* Devolve ao heap de prontos uma tarefa que esgotou seu quantum.
+*/
+boolean preemptToReadyHeap(Scheduler* scheduler, Core* core, TaskDescriptor* taskDescriptor, TimeUnit ran);
+
+/* Nível efetivo da tarefa na fila multinível: tarefas de uma época anterior ao último reinício voltam ao primeiro nível.
+*/
+unsigned int feedbackLevel(Scheduler* scheduler, TaskDescriptor* taskDescriptor);
+
+/* Coloca a tarefa na fila do seu nível na fila multinível.
+*/
+boolean enqueueFeedbackTask(Scheduler* scheduler, Core* core, TaskDescriptor* taskDescriptor);
+
+/* Admite uma tarefa no primeiro nível da fila multinível.
+*/
+boolean arriveFeedbackTask(Scheduler* scheduler, Core* core, TaskDescriptor* taskDescriptor);
+
+/* Rebaixa um nível a tarefa que esgotou seu quantum na fila multinível.
+*/
+boolean preemptFeedbackTask(Scheduler* scheduler, Core* core, TaskDescriptor* taskDescriptor, TimeUnit ran);
+
+/* Retira a primeira tarefa do nível mais alto não vazio da fila multinível do núcleo.
+   Periodicamente todas as tarefas voltam ao primeiro nível, em tempo constante por núcleo: as filas são concatenadas
+   e a época é incrementada, invalidando o nível guardado em cada tarefa.
+*/
+TaskDescriptor* pickFeedbackTask(Scheduler* scheduler, Core* core);
+
+/* Quantum da fila multinível: dobra a cada nível.
+*/
+TimeUnit feedbackQuantum(Scheduler* scheduler, TaskDescriptor* taskDescriptor);
+
+/* Admite uma tarefa na política fair-share com o menor tempo virtual atual.
+*/
+boolean arriveFairShareTask(Scheduler* scheduler, Core* core, TaskDescriptor* taskDescriptor);
+
+/* Retira a tarefa com menor tempo virtual e avança o tempo virtual mínimo.
+*/
+TaskDescriptor* pickFairShareTask(Scheduler* scheduler, Core* core);
+
+/* Contabiliza o tempo de CPU da tarefa no tempo virtual, ponderado pela prioridade.
+*/
+void chargeFairShareTask(Scheduler* scheduler, TaskDescriptor* taskDescriptor, TimeUnit ran);
+
+/* Devolve ao heap uma tarefa fair-share que esgotou seu quantum.
+*/
+boolean preemptFairShareTask(Scheduler* scheduler, Core* core, TaskDescriptor* taskDescriptor, TimeUnit ran);
+
+/* Devolve ao heap uma tarefa fair-share que despertou, sem permitir que ela acumule crédito enquanto suspensa.
+*/
+boolean wakeFairShareTask(Scheduler* scheduler, Core* core, TaskDescriptor* taskDescriptor);
+
+/* Procura uma política de escalonamento pelo nome usado na linha de comando.
+   Parâmetros:
+   - name: Nome da política.
+   - length: Quantidade de bytes do nome.
+   Retorno:
+   - Ponteiro para a política, ou NULL se o nome for desconhecido.
+*/
+const SchedulingPolicy* findSchedulingPolicy(const char *name, size_t length);
+
+/* Escolhe o próximo núcleo a escalonar: o de menor relógio local.
+   Avançar sempre o núcleo mais atrasado mantém os núcleos sincronizados e o relógio global monotônico.
+   Parâmetros:
+   - scheduler: Ponteiro para o escalonador.
+   Retorno:
+   - Ponteiro para o núcleo escolhido.
+*/
+Core* nextCore(Scheduler* scheduler);
+
+/* Retira a próxima tarefa pronta de um núcleo segundo a política de escalonamento.
+   Parâmetros:
+   - scheduler: Ponteiro para o escalonador.
+   - core: Núcleo cuja estrutura de prontos será consultada.
+   Retorno:
+   - Ponteiro para a tarefa, ou NULL se o núcleo não tiver tarefas prontas.
+*/
+TaskDescriptor* pickReadyTask(Scheduler* scheduler, Core* core);
+
+/* Rouba uma tarefa pronta do núcleo com mais tarefas prontas para um núcleo ocioso.
+   A tarefa roubada é a que a política escolheria em seguida no núcleo de origem, e a migração é contabilizada.
+   Só são vítimas os núcleos cujo relógio não passou do relógio do núcleo ocioso; sem vítima, o chamador avança o
+   relógio ocioso até o próximo evento. Se ainda assim a tarefa ficou pronta depois desse relógio, o chamador o avança
+   até o instante 'readyTime' antes de executá-la.
+   Parâmetros:
+   - scheduler: Ponteiro para o escalonador.
+   - thief: Núcleo ocioso que recebe a tarefa.
+   - roundRobin: Estrutura RoundRobin que acumula as migrações.
+   Retorno:
+   - Ponteiro para a tarefa roubada, ou NULL se nenhum outro núcleo tiver tarefas prontas.
+*/
+TaskDescriptor* stealTask(Scheduler* scheduler, Core* thief, RoundRobin* roundRobin);
+
+/* Verifica se todas as tarefas foram concluídas.
+   Compara a contagem de tarefas no estado 'FINISHED', mantida pelo RoundRobin, com o número total de tarefas,
+   em tempo constante.
+   Parâmetros:
+   - roundRobin: Estrutura RoundRobin com a contagem de tarefas por estado.
+   - numberOfTasks: Número total de tarefas.
+   Retorno:
+   - TRUE se todas as tarefas estiverem marcadas como 'FINISHED', FALSE caso contrário.
+*/
+boolean allTasksFinished(RoundRobin* roundRobin, int numberOfTasks);
+
+/* Altera o estado de uma tarefa, mantendo a contagem de tarefas por estado.
+   Todas as transições de estado durante o escalonamento devem passar por esta função, que também as inclui
+   no registro de execução, se houver.
+   Parâmetros:
+   - taskDescriptor: Ponteiro para o descritor de tarefa.
+   - status: Novo estado da tarefa.
+   - roundRobin: Estrutura RoundRobin com a contagem de tarefas por estado e o registro de execução.
+*/
+void changeTaskStatus(TaskDescriptor* taskDescriptor, TaskStatus status, RoundRobin* roundRobin);
+
+/* Simula a leitura do disco por uma tarefa.
+   Atualiza o status da tarefa para 'SUSPENDED', adiciona o tempo de E/S ao tempo de entrada/saída da tarefa e ao total
+   do sistema e insere a tarefa na fila de despertar com o instante absoluto em que ela volta a ficar pronta.
+   Parâmetros:
+   - taskDescriptor: Ponteiro para o descritor de tarefa a ser modificado.
+   - scheduler: Ponteiro para o escalonador.
+   - roundRobin: Estrutura RoundRobin com a contagem de tarefas por estado.
+*/
+void readDisk(TaskDescriptor* taskDescriptor, Scheduler* scheduler, RoundRobin* roundRobin);
+
+/* Imprime os descritores das tarefas ativas.
+   Itera sobre as tarefas verificando se foram abortadas. Se não foram abortadas,
+   imprime o descritor da tarefa usando a função 'printTaskDescriptor'.
+   Parâmetros:
+   - output: Saída do relatório.
+   - tasks: Array de descritores de tarefa.
+   - numberOfTasks: Número total de tarefas no array.
+   - roundRobin: Estrutura RoundRobin contendo informações do sistema.
+*/
+void printTasks(FILE *output, const TaskDescriptor tasks[], int numberOfTasks, const RoundRobin* roundRobin);
+
+/* Calcula a taxa de ocupação da CPU de uma tarefa.
+   Parâmetros:
+   - taskDesc: Descritor de tarefa (TaskDescriptor).
+   - roundRobin: Estrutura RoundRobin contendo informações do sistema.
+   Retorno:
+   - Taxa de ocupação da CPU (float).
+*/
+float calculateCPURate(const TaskDescriptor* taskDesc, const RoundRobin* roundRobin);
+
+/* Calcula a taxa de ocupação do disco de uma tarefa.
+   Parâmetros:
+   - taskDesc: Descritor de tarefa (TaskDescriptor).
+   - roundRobin: Estrutura RoundRobin contendo informações do sistema.
+   Retorno:
+   - Taxa de ocupação de disco (float).
+*/
+float calculateDiskRate(const TaskDescriptor* taskDesc, const RoundRobin* roundRobin);
+
+/* Calcula a taxa de ociosidade da CPU.
+   Parâmetros:
+   - roundRobin: Estrutura RoundRobin contendo informações do sistema.
+   Retorno:
+   - Percentual do tempo decorrido, somado em todos os núcleos, em que a CPU ficou ociosa (float).
+*/
+float calculateIdleRate(const RoundRobin* roundRobin);
+
+/* Calcula a taxa de ocupação de um núcleo de CPU.
+   Parâmetros:
+   - roundRobin: Estrutura RoundRobin contendo informações do sistema.
+   - core: Índice do núcleo.
+   Retorno:
+   - Percentual do tempo decorrido em que o núcleo executou instruções (float).
+*/
+float calculateCoreCPURate(const RoundRobin* roundRobin, unsigned int core);
+
+/* Calcula a taxa de faltas de página.
+   Parâmetros:
+   - pageFaults: Faltas de página.
+   - memoryAccesses: Acessos à memória.
+   Retorno:
+   - Porcentagem de acessos que causaram falta de página.
+*/
+float calculatePageFaultRate(unsigned long long pageFaults, unsigned long long memoryAccesses);
+
+/* Calcula a taxa de acertos da TLB.
+   Parâmetros:
+   - hits: Acertos na TLB.
+   - misses: Faltas na TLB.
+   Retorno:
+   - Porcentagem de consultas à TLB que foram acertos, ou 0 se a TLB não foi consultada.
+*/
+float calculateTlbHitRate(unsigned long long hits, unsigned long long misses);
+
+/* Calcula o tempo efetivo de acesso à memória com a TLB.
+   Um acerto custa a consulta à TLB e o acesso à memória; uma falta custa também a consulta à tabela de páginas.
+   Parâmetros:
+   - hits: Acertos na TLB.
+   - misses: Faltas na TLB.
+   Retorno:
+   - Tempo médio de acesso, em nanossegundos.
+*/
+float calculateEffectiveAccessTime(unsigned long long hits, unsigned long long misses);
+
+/* Conta o número de tarefas executadas com sucesso.
+   Itera sobre as tarefas verificando se foram abortadas. Se uma tarefa não foi abortada,
+   incrementa o contador de tarefas executadas com sucesso.
+   Parâmetros:
+   - tasks: Array de descritores de tarefa.
+   - numberOfTasks: Número total de tarefas no array.
+   Retorno:
+   - Número de tarefas executadas com sucesso.
+*/
+int numberOfTasksPerformedSuccessfully(const TaskDescriptor tasks[], int numberOfTasks);
+
+/* Imprime informações do Round-Robin.
+   Esta função imprime métricas da política de escalonamento, como o tempo médio de execução, o tempo médio de espera
+   e a vazão (tarefas concluídas por unidade de tempo de CPU), o tempo ocioso da CPU,
+   além da contagem de tarefas por estado, de tarefas abortadas, do pico de quadros físicos em uso e das esperas
+   por memória; a geometria de memória e o quantum, quando diferentes dos padrões; com limite de programas residentes,
+   o pico de programas residentes e as recargas. Na paginação sob demanda,
+   imprime a política de substituição, a taxa de faltas de página e as substituições; com TLB, a configuração,
+   os acertos, as faltas, os esvaziamentos e o tempo efetivo de acesso. Com mais de um núcleo, imprime também
+   as migrações e a ocupação, o tempo ocioso e os despachos de cada núcleo.
+   Utiliza o número de tarefas executadas com sucesso para calcular esses valores.
+   Parâmetros:
+   - output: Saída do relatório.
+   - roundRobin: Estrutura RoundRobin contendo informações do sistema.
+   - numberOfTasksPerformedSuccessfully: Número de tarefas executadas com sucesso.
+*/
+void printRoundRobin(FILE *output, const RoundRobin* roundRobin, int numberOfTasksPerformedSuccessfully);
+
+/* Imprime as informações de memória de uma variável da tarefa.
+   Os endereços físicos são traduzidos pela tabela de páginas ao final da execução.
+   Parâmetros:
+   - output: Saída do relatório.
+   - taskDesc: Descritor de tarefa (TaskDescriptor) dona da variável.
+   - var: Variável (Variable) da tarefa.
+   - machine: Geometria de memória, que define a página e o deslocamento dos endereços.
+*/
+void printVariableMemoryInfo(FILE *output, const TaskDescriptor* taskDesc, const Variable* var, const MachineConfiguration* machine);
+
+/* Imprime a tabela de páginas de uma tarefa, com o quadro físico de cada página mapeada.
+   Na paginação sob demanda, mostra os quadros das páginas residentes ao final da execução.
+   Parâmetros:
+   - output: Saída do relatório.
+   - taskDesc: Descritor de tarefa (TaskDescriptor).
+   - machine: Geometria de memória.
+*/
+void printPageTableInfo(FILE *output, const TaskDescriptor* taskDesc, const MachineConfiguration* machine);
+
+/* Imprime todas as informações de uma tarefa, incluindo a taxa de faltas de página na paginação sob demanda
+   e os acertos na TLB com o tempo efetivo de acesso.
+   Parâmetros:
+   - output: Saída do relatório.
+   - taskDesc: Descritor de tarefa (TaskDescriptor).
+   - roundRobin: Estrutura RoundRobin contendo informações do sistema.
+*/
+void printTaskDescriptor(FILE *output, const TaskDescriptor* taskDesc, const RoundRobin* roundRobin);
+
+/* Imprime o relatório de uma simulação no formato texto: as métricas da política e as tarefas executadas.
+   Parâmetros:
+   - output: Saída do relatório.
+   - roundRobin: Estrutura RoundRobin contendo informações do sistema.
+   - tasks: Array de descritores de tarefa.
+   - numberOfTasks: Número total de tarefas no array.
+*/
+void printTextReport(FILE *output, const RoundRobin* roundRobin, const TaskDescriptor tasks[], int numberOfTasks);
+
+/* Imprime a identificação de um cenário do modo em lote no formato texto.
+   Parâmetros:
+   - output: Saída do relatório.
+   - number: Número do cenário, a partir de 1.
+   - description: Linha da lista de cenários.
+*/
+void printTextScenarioHeader(FILE *output, int number, const char *description);
+
+/* Imprime uma cadeia de caracteres como string JSON, entre aspas e com os caracteres especiais escapados.
+   Parâmetros:
+   - output: Saída do relatório.
+   - text: Cadeia de caracteres (UTF-8).
+*/
+void printJsonString(FILE *output, const char *text);
+
+/* Imprime um número JSON com duas casas decimais, ou null quando o valor não é finito (por exemplo, médias sem tarefas).
+   Parâmetros:
+   - output: Saída do relatório.
+   - value: Valor a ser impresso.
+*/
+void printJsonNumber(FILE *output, double value);
+
+/* Imprime os campos que identificam uma simulação, compartilhados pelas linhas JSON da simulação e das suas tarefas.
+   Parâmetros:
+   - output: Saída do relatório.
+   - roundRobin: Estrutura RoundRobin contendo informações do sistema.
+*/
+void printJsonSimulationFields(FILE *output, const RoundRobin* roundRobin);
+
+/* Imprime uma tarefa como uma linha JSON, com as variáveis e a tabela de páginas (null nas páginas não residentes).
+   Os acessos à memória não são listados, apenas contados.
+   Parâmetros:
+   - output: Saída do relatório.
+   - taskDesc: Descritor de tarefa (TaskDescriptor).
+   - roundRobin: Estrutura RoundRobin contendo informações do sistema.
+*/
+void printJsonTask(FILE *output, const TaskDescriptor* taskDesc, const RoundRobin* roundRobin);
+
+/* Imprime o relatório de uma simulação no formato JSON Lines: uma linha com as métricas da simulação e uma linha
+   por tarefa, inclusive as abortadas. Os números usam sempre o ponto decimal, qualquer que seja a região da thread.
+   Parâmetros:
+   - output: Saída do relatório.
+   - roundRobin: Estrutura RoundRobin contendo informações do sistema.
+   - tasks: Array de descritores de tarefa.
+   - numberOfTasks: Número total de tarefas no array.
+*/
+void printJsonlReport(FILE *output, const RoundRobin* roundRobin, const TaskDescriptor tasks[], int numberOfTasks);
+
+/* Imprime a identificação de um cenário do modo em lote como uma linha JSON.
+   Parâmetros:
+   - output: Saída do relatório.
+   - number: Número do cenário, a partir de 1.
+   - description: Linha da lista de cenários.
+*/
+void printJsonlScenarioHeader(FILE *output, int number, const char *description);
+
+/* Imprime um campo CSV, entre aspas (com as aspas internas duplicadas) quando contém vírgula, aspas ou quebra de linha.
+   Parâmetros:
+   - output: Saída do relatório.
+   - text: Conteúdo do campo.
+*/
+void printCsvField(FILE *output, const char *text);
+
+/* Imprime a linha de cabeçalho do formato CSV.
+   Parâmetros:
+   - output: Saída do relatório.
+*/
+void printCsvHeader(FILE *output);
+
+/* Imprime o relatório de uma simulação no formato CSV: uma linha por tarefa, inclusive as abortadas, com as colunas
+   de CSV_REPORT_HEADER. As taxas sem valor definido ficam vazias, e os números usam sempre o ponto decimal.
+   Parâmetros:
+   - output: Saída do relatório.
+   - roundRobin: Estrutura RoundRobin contendo informações do sistema.
+   - tasks: Array de descritores de tarefa.
+   - numberOfTasks: Número total de tarefas no array.
+*/
+void printCsvReport(FILE *output, const RoundRobin* roundRobin, const TaskDescriptor tasks[], int numberOfTasks);
+
+/* Procura um formato de relatório pelo nome usado na linha de comando.
+   Parâmetros:
+   - name: Nome do formato.
+   Retorno:
+   - Ponteiro para o formato, ou NULL se o nome for desconhecido.
+*/
+const ReportFormat* findReportFormat(const char *name);
+
+/* Calcula os valores derivados da geometria de memória e verifica se ela é válida.
+   A memória reservada ocupa os primeiros quadros, arredondada para cima; os quadros restantes precisam
+   comportar todas as páginas de uma tarefa, para que a admissão de uma tarefa nunca espere para sempre.
+   Parâmetros:
+   - machine: Geometria com o tamanho de página e os tamanhos das memórias física e lógica já definidos.
+   Retorno:
+   - TRUE se a geometria é válida, FALSE caso contrário.
+*/
+boolean configureMachine(MachineConfiguration* machine);
+
+/* Calcula a página de um endereço lógico ou o quadro de um endereço físico.
+   Parâmetros:
+   - machine: Geometria de memória.
+   - address: Endereço, em bytes.
+   Retorno:
+   - Número da página (ou do quadro).
+*/
+unsigned int addressPage(const MachineConfiguration* machine, unsigned int address);
+
+/* Calcula o deslocamento de um endereço dentro da sua página.
+   Parâmetros:
+   - machine: Geometria de memória.
+   - address: Endereço, em bytes.
+   Retorno:
+   - Deslocamento, em bytes, a partir do início da página.
+*/
+unsigned int addressOffset(const MachineConfiguration* machine, unsigned int address);
+
+/* Calcula o endereço do primeiro byte de uma página ou de um quadro.
+   Parâmetros:
+   - machine: Geometria de memória.
+   - page: Número da página (ou do quadro).
+   Retorno:
+   - Endereço inicial, em bytes.
+*/
+unsigned int pageAddress(const MachineConfiguration* machine, unsigned int page);
+
+/* Inicializa o alocador de quadros, marcando como livres todos os quadros fora da memória reservada.
+   O mapa de bits e os quadros são alocados conforme a geometria de memória da simulação.
+   Parâmetros:
+   - allocator: Alocador de quadros a ser inicializado.
+   - machine: Geometria de memória, mantida pelo chamador durante a simulação.
+*/
+void initializeFrameAllocator(FrameAllocator* allocator, const MachineConfiguration* machine);
+
+/* Libera o mapa de bits e os quadros do alocador; as estatísticas continuam disponíveis para o relatório.
+   Parâmetros:
+   - allocator: Alocador de quadros.
+*/
+void destroyFrameAllocator(FrameAllocator* allocator);
+
+/* Retira do mapa de bits o quadro livre de menor número.
+   Parâmetros:
+   - allocator: Alocador de quadros.
+   Retorno:
+   - Número do quadro alocado, ou NO_FRAME se não houver quadros livres.
+*/
+unsigned int allocateFrame(FrameAllocator* allocator);
+
+/* Devolve um quadro ao mapa de quadros livres.
+   Parâmetros:
+   - allocator: Alocador de quadros.
+   - frame: Número do quadro liberado.
+*/
+void releaseFrame(FrameAllocator* allocator, unsigned int frame);
+
+/* Carrega uma página da tarefa em um quadro, atualizando a tabela de páginas e os dados do quadro.
+   Parâmetros:
+   - allocator: Alocador de quadros.
+   - frame: Quadro que recebe a página.
+   - taskDescriptor: Descritor da tarefa dona da página.
+   - page: Página lógica carregada.
+*/
+void installPage(FrameAllocator* allocator, unsigned int frame, TaskDescriptor* taskDescriptor, unsigned int page);
+
+/* Traduz um endereço lógico da tarefa para o endereço físico, pela tabela de páginas.
+   Parâmetros:
+   - taskDescriptor: Descritor da tarefa.
+   - machine: Geometria de memória.
+   - logicalByte: Endereço lógico, em uma página já mapeada.
+   Retorno:
+   - Endereço físico correspondente.
+*/
+unsigned int translateAddress(const TaskDescriptor* taskDescriptor, const MachineConfiguration* machine, unsigned int logicalByte);
+
+/* Calcula quantas páginas a tarefa terá mapeadas no pico de uso da memória.
+   Percorre o programa aplicando as mesmas regras de 'header()' e 'new()', até a primeira instrução que excederia
+   a memória lógica (e abortaria a tarefa).
+   Parâmetros:
+   - program: Programa da tarefa.
+   - machine: Geometria de memória.
+   Retorno:
+   - Número de páginas lógicas que a tarefa chega a mapear.
+*/
+unsigned int countRequiredPages(const TaskProgram* program, const MachineConfiguration* machine);
+
+/* Admite uma tarefa na memória física, reservando os quadros do seu pico de uso.
+   Parâmetros:
+   - taskDescriptor: Descritor da tarefa.
+   - allocator: Alocador de quadros.
+   - frames: Quantidade de quadros reservados.
+*/
+void reserveTaskFrames(TaskDescriptor* taskDescriptor, FrameAllocator* allocator, unsigned int frames);
+
+/* Mapeia, página a página, as páginas lógicas da tarefa até a que contém o byte informado.
+   Na paginação sob demanda as páginas entram na tabela sem quadro e só são carregadas no primeiro acesso.
+   Caso contrário, os quadros vêm do alocador e não precisam ser contíguos. No primeiro mapeamento a tarefa é admitida na memória física:
+   os quadros do seu pico de uso são reservados, de modo que os mapeamentos seguintes nunca esperam. Se não houver
+   quadros livres para a reserva, ou se outras tarefas já esperam, a tarefa é suspensa na fila de espera por memória,
+   sem ocupar quadros, e a instrução será repetida ao despertar. A tabela de páginas cresce conforme as páginas mapeadas.
+   Parâmetros:
+   - taskDescriptor: Descritor da tarefa.
+   - lastByte: Último byte lógico que precisa estar mapeado.
+   - scheduler: Ponteiro para o escalonador, com a fila de espera por memória.
+   - roundRobin: Ponteiro para a estrutura RoundRobin, com o alocador de quadros.
+   Retorno:
+   - TRUE se as páginas estão mapeadas, FALSE se a tarefa foi suspensa à espera de quadros
+     ou abortada por falta de memória para a tabela de páginas.
+*/
+boolean mapTaskPages(TaskDescriptor* taskDescriptor, unsigned int lastByte, Scheduler* scheduler, RoundRobin* roundRobin);
+
+/* Devolve ao alocador os quadros e a reserva restante de uma tarefa finalizada.
+   A tabela de páginas é mantida, pois o relatório da tarefa mostra o mapeamento usado na execução.
+   Parâmetros:
+   - taskDescriptor: Descritor da tarefa.
+   - allocator: Alocador de quadros.
+*/
+void releaseTaskFrames(TaskDescriptor* taskDescriptor, FrameAllocator* allocator);
+
+/* Escolhe a página carregada há mais tempo (FIFO).
+   Parâmetros:
+   - allocator: Alocador de quadros, sem quadros livres.
+   Retorno:
+   - Quadro da página substituída.
+*/
+unsigned int selectFifoVictim(FrameAllocator* allocator);
+
+/* Escolhe a página referenciada há mais tempo (LRU).
+   Parâmetros:
+   - allocator: Alocador de quadros, sem quadros livres.
+   Retorno:
+   - Quadro da página substituída.
+*/
+unsigned int selectLruVictim(FrameAllocator* allocator);
+
+/* Escolhe a página pela política do relógio (segunda chance).
+   O ponteiro percorre os quadros circularmente: páginas referenciadas perdem o bit de referência e ganham
+   uma segunda chance, e a primeira página sem o bit é substituída.
+   Parâmetros:
+   - allocator: Alocador de quadros, sem quadros livres.
+   Retorno:
+   - Quadro da página substituída.
+*/
+unsigned int selectClockVictim(FrameAllocator* allocator);
+
+/* Calcula quantas instruções faltam para a tarefa acessar novamente uma página.
+   Percorre o programa a partir da próxima instrução, recarregando-o se foi descartado; acessos a variáveis ainda
+   não declaradas não são considerados, e uma página de programa que não pôde ser recarregado não é mais acessada.
+   Parâmetros:
+   - taskDescriptor: Descritor da tarefa dona da página.
+   - machine: Geometria de memória.
+   - page: Página lógica.
+   Retorno:
+   - Distância, em instruções, até o próximo acesso, ou ULLONG_MAX se a página não for mais acessada.
+*/
+unsigned long long nextPageReference(const TaskDescriptor* taskDescriptor, const MachineConfiguration* machine, unsigned int page);
+
+/* Escolhe a página cujo próximo acesso está mais distante (ótima, de Belady).
+   A política é uma referência: conhece o restante do programa de cada tarefa, e a distância é medida
+   em instruções da própria tarefa dona da página.
+   Parâmetros:
+   - allocator: Alocador de quadros, sem quadros livres.
+   Retorno:
+   - Quadro da página substituída.
+*/
+unsigned int selectOptimalVictim(FrameAllocator* allocator);
+
+/* Procura uma política de substituição de páginas pelo nome usado na linha de comando.
+   Parâmetros:
+   - name: Nome da política.
+   - length: Quantidade de bytes do nome.
+   Retorno:
+   - Ponteiro para a política, ou NULL se o nome for desconhecido.
+*/
+const ReplacementPolicy* findReplacementPolicy(const char *name, size_t length);
+
+/* Lê a configuração da TLB no formato entradas[:vias[:lru|fifo[:flush|asid]]].
+   Sem vias, a TLB é totalmente associativa; por padrão a substituição é LRU e a TLB é esvaziada
+   a cada troca de contexto.
+   Parâmetros:
+   - text: Configuração informada na linha de comando.
+   - configuration: Recebe a configuração lida.
+   Retorno:
+   - TRUE se a configuração é válida, FALSE caso contrário.
+*/
+boolean parseTlbConfiguration(const char *text, TlbConfiguration* configuration);
+
+/* Consulta a TLB do núcleo em execução pela tradução de uma página da tarefa, contabilizando o acerto ou a falta.
+   Parâmetros:
+   - scheduler: Ponteiro para o escalonador, com a TLB de cada núcleo.
+   - roundRobin: Estrutura RoundRobin com a configuração da TLB e o núcleo em execução.
+   - taskDescriptor: Descritor da tarefa.
+   - page: Página lógica traduzida.
+   - frame: Recebe o quadro físico em caso de acerto.
+   Retorno:
+   - TRUE se a tradução estava na TLB, FALSE em caso de falta ou se a simulação não usa TLB.
+*/
+boolean lookupTlb(Scheduler* scheduler, RoundRobin* roundRobin, TaskDescriptor* taskDescriptor, unsigned int page, unsigned int *frame);
+
+/* Insere na TLB do núcleo em execução a tradução de uma página, obtida da tabela de páginas após uma falta.
+   Uma entrada inválida do conjunto é usada primeiro; caso contrário, a entrada escolhida pela substituição (LRU ou FIFO).
+   Parâmetros:
+   - scheduler: Ponteiro para o escalonador, com a TLB de cada núcleo.
+   - roundRobin: Estrutura RoundRobin com a configuração da TLB e o núcleo em execução.
+   - taskDescriptor: Descritor da tarefa.
+   - page: Página lógica, residente.
+*/
+void insertTlbEntry(Scheduler* scheduler, RoundRobin* roundRobin, TaskDescriptor* taskDescriptor, unsigned int page);
+
+/* Invalida, nas TLBs de todos os núcleos, a tradução de uma página que deixou de estar residente.
+   Parâmetros:
+   - scheduler: Ponteiro para o escalonador, com a TLB de cada núcleo.
+   - roundRobin: Estrutura RoundRobin com a configuração da TLB.
+   - taskDescriptor: Descritor da tarefa dona da página.
+   - page: Página lógica substituída.
+*/
+void invalidateTlbEntry(Scheduler* scheduler, RoundRobin* roundRobin, const TaskDescriptor* taskDescriptor, unsigned int page);
+
+/* Registra a troca de contexto de um núcleo quando ele passa a executar outra tarefa: sem ASID, a TLB é esvaziada;
+   com ASID, as entradas das outras tarefas são mantidas.
+   Parâmetros:
+   - core: Núcleo que vai executar a tarefa.
+   - roundRobin: Estrutura RoundRobin com a configuração da TLB e a contagem de esvaziamentos.
+   - taskDescriptor: Tarefa despachada para o núcleo.
+*/
+void switchTlbContext(Core* core, RoundRobin* roundRobin, const TaskDescriptor* taskDescriptor);
+
+/* Trata a falta de página de uma tarefa, carregando a página em um quadro livre ou, se não houver,
+   no quadro da página escolhida pela política de substituição, que deixa de estar residente e sai das TLBs.
+   Parâmetros:
+   - taskDescriptor: Descritor da tarefa que acessou a página.
+   - page: Página lógica acessada.
+   - scheduler: Ponteiro para o escalonador, com a TLB de cada núcleo.
+   - roundRobin: Estrutura RoundRobin com o alocador de quadros e as estatísticas de paginação.
+*/
+void handlePageFault(TaskDescriptor* taskDescriptor, unsigned int page, Scheduler* scheduler, RoundRobin* roundRobin);
+
+/* Atualiza a memória lógica de uma variável de uma tarefa.
+   Esta função atualiza os endereços lógicos de uma variável da tarefa com base no valor alocado.
+   Calcula os endereços lógicos inicial e final, bem como atualiza a página final de paginação da tarefa.
+   Parâmetros:
+   - taskDescriptor: Ponteiro para o descritor de tarefa (TaskDescriptor).
    - index: Índice da variável no array de variáveis da tarefa.
    - value: Valor alocado para a variável.
+   - machine: Geometria de memória.
+*/
+void updateLogicalMemory(TaskDescriptor* taskDescriptor, int index, int value, const MachineConfiguration* machine);
+
+/* Executa a instrução 'new' para simular a alocação de variáveis para uma tarefa.
+   Esta função recebe a instrução já decodificada, com a variável e seu valor alocado.
+   Em seguida, verifica pelo índice do símbolo, sem comparar nomes, se a variável já foi declarada.
+   Se não, aloca a variável na memória lógica da tarefa e mapeia em quadros físicos as páginas que ela ocupa;
+   não há limite para o número de variáveis. Sem quadros livres, a tarefa espera e a instrução é repetida.
+   Parâmetros:
+   - instruction: Instrução decodificada a ser executada.
+   - taskDescriptor: Ponteiro para o descritor de tarefa (TaskDescriptor).
+   - scheduler: Ponteiro para o escalonador, com a fila de espera por memória.
+   - roundRobin: Ponteiro para a estrutura RoundRobin contendo informações do sistema.
+   Retorno:
+   - TRUE se a alocação da variável for bem-sucedida, FALSE caso contrário.
+*/
+boolean new(const ParsedInstruction* instruction, TaskDescriptor* taskDescriptor, Scheduler* scheduler, RoundRobin* roundRobin);
+
+/* Registra um acesso à memória no registro de acessos da tarefa.
+   O registro cresce em blocos encadeados, sem copiar os acessos já registrados.
+   Parâmetros:
+   - accessLog: Registro de acessos da tarefa.
+   - variable: Índice da variável acessada.
+   - offset: Deslocamento acessado dentro da variável.
+   - physicalAddress: Endereço físico acessado.
+   - timestamp: Instante do acesso.
+   Retorno:
+   - TRUE se o acesso foi registrado, FALSE se não houve memória disponível.
+*/
+boolean appendMemoryAccess(MemoryAccessLog* accessLog, unsigned int variable, unsigned int offset, unsigned int physicalAddress, TimeUnit timestamp);
+
+/* Libera todos os blocos do registro de acessos à memória.
+   Parâmetros:
+   - accessLog: Registro de acessos a ser liberado.
+*/
+void freeMemoryAccessLog(MemoryAccessLog* accessLog);
+
+/* Imprime os acessos à memória das variáveis de uma tarefa.
+   Esta função percorre, bloco a bloco, o registro de acessos à memória da tarefa e imprime os endereços lógicos e físicos
+   para cada acesso; o endereço físico é o traduzido pela tabela de páginas no instante do acesso.
+   Parâmetros:
+   - output: Saída do relatório.
+   - taskDesc: Descritor da tarefa (TaskDescriptor) contendo os acessos à memória.
+   - machine: Geometria de memória.
+*/
+void printTaskMemoryAccesses(FILE *output, const TaskDescriptor* taskDesc, const MachineConfiguration* machine);
+
+/* Simula um acesso à memória de uma variável.
+   Esta função recebe a instrução decodificada para acessar a memória de uma variável específica da tarefa.
+   A variável é resolvida pelo índice do símbolo, em tempo constante. Se ela estiver declarada,
+   o acesso à memória é registrado, de forma compacta, no registro de acessos da tarefa. A tradução do endereço
+   consulta primeiro a TLB do núcleo e, em caso de falta, a tabela de páginas. Na paginação sob demanda,
+   o acesso a uma página não residente causa uma falta de página: a página é carregada e a tarefa é suspensa
+   pelo mesmo caminho da leitura de disco.
+   Parâmetros:
+   - instruction: Instrução decodificada de acesso à memória.
+   - taskDescriptor: Ponteiro para o descritor da tarefa (TaskDescriptor).
+   - scheduler: Ponteiro para o escalonador, cujo relógio marca o instante do acesso.
+   - roundRobin: Ponteiro para a estrutura RoundRobin contendo informações do sistema.
+   Retorno:
+   - TRUE se o acesso à memória foi realizado com sucesso; FALSE caso contrário.
+*/
+boolean memoryAccess(const ParsedInstruction* instruction, TaskDescriptor* taskDescriptor, Scheduler* scheduler, RoundRobin* roundRobin);
+
+/* Finaliza uma tarefa.
+   Esta função atualiza o status de uma tarefa para finalizada e configura a marca de abortada, se aplicável.
+   Atualiza também o tempo de término, libera o programa e os quadros físicos da tarefa e ajusta as métricas globais do sistema.
+   Parâmetros:
+   - taskDescriptor: Ponteiro para o descritor da tarefa (TaskDescriptor).
+   - aborted: Indica se a tarefa foi abortada (TRUE) ou concluída com sucesso (FALSE).
+   - roundRobin: Ponteiro para a estrutura RoundRobin contendo informações do sistema.
+*/
+void finishTask(TaskDescriptor* taskDescriptor, boolean aborted, RoundRobin* roundRobin);
+
+/* Aborta uma tarefa que não pôde ser colocada em uma estrutura do escalonador por falta de memória.
+   Parâmetros:
+   - taskDescriptor: Ponteiro para o descritor da tarefa.
+   - roundRobin: Ponteiro para a estrutura RoundRobin, com a saída das mensagens da simulação.
+*/
+void abortUnscheduledTask(TaskDescriptor* taskDescriptor, RoundRobin* roundRobin);
+
+/* Verifica e atualiza as tarefas suspensas.
+   Esta função avança o relógio do escalonador pelo número de unidades de tempo especificado e retira da fila de
+   despertar apenas as tarefas cujo instante de despertar já foi alcançado, sem percorrer as demais tarefas.
+   As tarefas despertadas têm o status atualizado para READY e são devolvidas à política de escalonamento,
+   no núcleo em que executaram por último, na ordem do instante de despertar e, em caso de empate, na ordem de suspensão.
+   Parâmetros:
+   - scheduler: Ponteiro para o escalonador.
+   - roundRobin: Estrutura RoundRobin com a contagem de tarefas por estado.
+   - timeUnits: Unidades de tempo decorridas desde a última verificação.
+*/
+void checkAndUpdateSuspendedTasks(Scheduler* scheduler, RoundRobin* roundRobin, unsigned timeUnits);
+
+/* Desperta, em ordem de chegada, as tarefas que esperam por quadros livres.
+   Cada tarefa despertada é admitida na memória física com a reserva dos quadros que esperava; a fila para na
+   primeira tarefa que não cabe nos quadros restantes, para que uma espera longa não seja ultrapassada.
+   Parâmetros:
+   - scheduler: Ponteiro para o escalonador.
+   - roundRobin: Estrutura RoundRobin com o alocador de quadros e a contagem de tarefas por estado.
+*/
+void wakeMemoryWaiters(Scheduler* scheduler, RoundRobin* roundRobin);
+
+/* Avança o relógio de um núcleo ocioso até um instante, contabilizando o intervalo como tempo ocioso.
+   Parâmetros:
+   - scheduler: Ponteiro para o escalonador.
+   - core: Núcleo ocioso.
+   - time: Instante, não anterior ao relógio do núcleo, até o qual o núcleo fica ocioso.
+   - roundRobin: Estrutura RoundRobin que acumula o tempo ocioso.
+*/
+void idleCoreUntil(Scheduler* scheduler, Core* core, TimeUnit time, RoundRobin* roundRobin);
+
+/* Avança o relógio do núcleo diretamente até o próximo evento quando não há tarefa pronta.
+   Em vez de simular a CPU ociosa uma unidade de tempo por vez, o relógio do núcleo salta para o menor instante
+   de despertar da fila de tarefas suspensas, para a chegada da próxima tarefa ou para o relógio de outro núcleo
+   mais adiantado (que pode devolver uma tarefa preemptada), e o intervalo saltado é contabilizado como tempo ocioso.
+   Parâmetros:
+   - scheduler: Ponteiro para o escalonador.
+   - core: Núcleo ocioso.
+   - roundRobin: Estrutura RoundRobin que acumula o tempo ocioso.
+   - numberOfTasks: Número total de tarefas, para saber se ainda há chegadas.
+   Retorno:
+   - TRUE se o relógio foi avançado, FALSE se não há evento futuro.
+*/
+boolean fastForwardIdleTime(Scheduler* scheduler, Core* core, RoundRobin* roundRobin, int numberOfTasks);
+
+/* Arredonda um número float para o inteiro mais próximo.
+   Esta função recebe um número em ponto flutuante e retorna o valor arredondado para o inteiro mais próximo.
+   Parâmetros:
+   - number: Número em ponto flutuante a ser arredondado.
+   Retorno:
+   - Valor arredondado para o inteiro mais próximo (int).
+*/
+int roundingNumber(float number);
+
+/* Atualiza a paginação de uma tarefa com base nos bytes alocados.
+   Esta função atualiza os valores de paginação de uma tarefa com base na quantidade de bytes alocados.
+   Parâmetros:
+   - taskDescriptor: Ponteiro para o descritor de tarefa (TaskDescriptor) a ser atualizado.
+   - bytes: Quantidade de bytes alocados.
+   - machine: Geometria de memória.
+*/
+void updatePagination(TaskDescriptor* taskDescriptor, unsigned int bytes, const MachineConfiguration* machine);
+
+/* Processa um cabeçalho de instrução para atualizar a paginação de uma tarefa.
+   Esta função processa o cabeçalho de uma instrução para atualizar os valores de paginação
+   de uma tarefa com base nos bytes especificados no cabeçalho, mapeando em quadros físicos as páginas do programa.
+   Sem quadros livres, a tarefa espera e o cabeçalho é repetido.
+   Parâmetros:
+   - instruction: Instrução decodificada do cabeçalho.
+   - taskDescriptor: Ponteiro para o descritor de tarefa (TaskDescriptor) a ser atualizado.
+   - scheduler: Ponteiro para o escalonador, com a fila de espera por memória.
+   - roundRobin: Ponteiro para a estrutura RoundRobin contendo informações do sistema.
+   Retorno:
+   - Retorna TRUE se a operação for bem-sucedida; FALSE, caso contrário.
+*/
+boolean header(const ParsedInstruction* instruction, TaskDescriptor* taskDescriptor, Scheduler* scheduler, RoundRobin* roundRobin);
+
+/* Determina o tipo de instrução e extrai seus operandos em uma única passagem.
+   Esta função é um analisador léxico escrito à mão que reconhece os padrões das instruções
+   (cabeçalho, new, acesso à memória e leitura de disco) sem compilar expressões regulares.
+   Parâmetros:
+   - instruction: Bytes da instrução a ser verificada (não precisa terminar com '\0').
+   - length: Quantidade de bytes da instrução.
+   - parsed: Estrutura que recebe o tipo e os operandos da instrução.
+   Retorno:
+   - Retorna um enum do tipo Instruction correspondente ao tipo de instrução encontrado,
+     ou INVALID_INSTRUCTION caso não corresponda a nenhum padrão conhecido.
+*/
+Instruction determineInstructionType(const char *instruction, size_t length, ParsedInstruction* parsed);
+
+/* Executa as instruções de uma tarefa dentro do quantum definido.
+   Esta função executa as instruções de uma tarefa dentro do quantum definido pela política de escalonamento.
+   Nas políticas não preemptivas, a tarefa executa até ser suspensa ou finalizada; em todas, a fatia termina assim que
+   a tarefa é suspensa ou finalizada. O contador de preempção excede em UT as unidades de tempo consumidas.
+   Parâmetros:
+   - scheduler: Ponteiro para o escalonador.
+   - roundRobin: Ponteiro para a estrutura RoundRobin contendo informações do sistema.
+   - taskDescriptor: Ponteiro para o descritor da tarefa em execução.
+   Retorno:
+   - Retorna o valor do contador de preempção após a execução das instruções.
+*/
+int executeInstruction(Scheduler* scheduler, RoundRobin* roundRobin, TaskDescriptor* taskDescriptor);
+
+/* Inicializa a estrutura RoundRobin com valores iniciais.
+   Esta função atribui valores iniciais aos campos da estrutura RoundRobin.
+   Parâmetros:
+   - roundRobin: Ponteiro para a estrutura RoundRobin a ser inicializada.
+*/
+void initializeRoundRobin(RoundRobin* roundRobin);
+
+/* Inicializa a fila de descritores de tarefa.
+   Esta função marca o instante de chegada das tarefas prontas e não abortadas, que a tarefa i recebe no instante i,
+   e faz a contagem inicial de tarefas por estado. As tarefas são admitidas na política por 'admitArrivedTasks()'
+   quando o relógio alcança a sua chegada.
+   Parâmetros:
+   - scheduler: Ponteiro para o escalonador cuja fila de tarefas prontas será inicializada.
+   - roundRobin: Estrutura RoundRobin que recebe a contagem de tarefas por estado.
+   - tasks: Array de descritores de tarefa.
+   - numberOfTasks: Número total de tarefas no array.
+*/
+void initializeTaskQueue(Scheduler* scheduler, RoundRobin* roundRobin, TaskDescriptor tasks[], int numberOfTasks);
+
+/* Admite na política de escalonamento as tarefas que chegaram até um instante.
+   As tarefas chegam em ordem, cada uma no instante igual ao seu índice, e entram na estrutura de prontos do seu núcleo;
+   uma tarefa que a política não consegue admitir é abortada. Assim, a política só escolhe tarefas que já chegaram.
+   Parâmetros:
+   - scheduler: Ponteiro para o escalonador.
+   - roundRobin: Estrutura RoundRobin com a contagem de tarefas por estado.
+   - tasks: Array de descritores de tarefa.
+   - numberOfTasks: Número total de tarefas no array.
+   - time: Instante até o qual as chegadas são admitidas.
+*/
+void admitArrivedTasks(Scheduler* scheduler, RoundRobin* roundRobin, TaskDescriptor tasks[], int numberOfTasks, TimeUnit time);
+
+/* Executa o escalonamento e execução das tarefas.
+   Esta função executa o escalonamento e a execução das tarefas enquanto houver tarefas a serem processadas.
+   A cada passo escalona o núcleo com o menor relógio local; um núcleo sem tarefas prontas rouba trabalho
+   do núcleo mais carregado e, se não houver trabalho, seu relógio avança diretamente até o próximo evento.
+   Uma tarefa nunca executa antes do instante em que ficou pronta: o núcleo fica ocioso até lá.
+   Parâmetros:
+   - scheduler: Ponteiro para o escalonador.
+   - roundRobin: Estrutura de informações do Round-Robin.
+   - tasks: Array de descritores de tarefa.
+   - numberOfTasks: Número total de tarefas no array.
+*/
+void runTasks(Scheduler* scheduler, RoundRobin* roundRobin, TaskDescriptor tasks[], int numberOfTasks);
+
+/* Agenda e executa as tarefas usando a política de escalonamento informada.
+   Esta função cria uma estrutura RoundRobin, o escalonador (estruturas de prontos da política e fila de despertar)
+   e coordena a execução das tarefas até que todas as tarefas tenham sido executadas.
+   Parâmetros:
+   - tasks: Array de descritores de tarefa.
+   - numberOfTasks: Número total de tarefas no array.
+   - policy: Política de escalonamento.
+   - replacement: Política de substituição de páginas, ou NULL para manter as páginas residentes.
+   - tlb: Configuração da TLB dos núcleos.
+   - machine: Geometria de memória e quantum, já configurados por 'configureMachine()'.
+   - numberOfCores: Número de núcleos simulados.
+   - trace: Registro de execução, ou NULL para não registrar as transições de estado.
+   - checkpoint: Estado salvo durante a simulação e estado restaurado no lugar da admissão das tarefas, ou NULL.
+     Se a restauração falhar, as tarefas não são executadas e 'checkpoint->restoreFailed' é marcado.
+   - output: Saída das mensagens da simulação.
+   Retorno:
+   - Estrutura RoundRobin com informações de execução das tarefas.
+*/
+RoundRobin scheduleTasks(TaskDescriptor tasks[], int numberOfTasks, const SchedulingPolicy* policy, const ReplacementPolicy* replacement, const TlbConfiguration* tlb, const MachineConfiguration* machine, unsigned int numberOfCores, EventTrace* trace, Checkpoint* checkpoint, FILE *output);
+
+/* Lê uma sequência de dígitos decimais a partir da posição atual.
+   Parâmetros:
+   - cursor: Ponteiro para a posição atual da leitura, avançado até o primeiro byte que não é dígito.
+   - end: Fim dos bytes da instrução.
+   - value: Recebe o número lido, saturado em UINT_MAX.
+   Retorno:
+   - TRUE se pelo menos um dígito foi lido, FALSE caso contrário.
+*/
+boolean scanNumber(const char **cursor, const char *end, unsigned int *value);
+
+/* Copia o identificador de uma instrução decodificada para uma String terminada em '\0'.
+   Parâmetros:
+   - destination: String que recebe o identificador.
+   - instruction: Instrução decodificada contendo o identificador.
+*/
+void copyIdentifier(String destination, const ParsedInstruction* instruction);
+
+/* Valida o número de tarefas fornecidas ao programa.
+   Esta função verifica se pelo menos uma tarefa foi informada, seja por argumento, manifesto ou padrão glob.
+   Não há limite superior: a tabela de tarefas é alocada dinamicamente.
+   Parâmetros:
+   - numberOfTasks: O número de tarefas coletadas.
+   Retorno:
+   - TRUE se o número de tarefas for válido, FALSE caso contrário.
+*/
+boolean validateNumberOfArguments(int numberOfTasks);
+
+/* Adiciona o nome de uma tarefa à lista de tarefas.
+   A extensão FILE_EXTENSION é removida, caso presente, pois ela é acrescentada na abertura do arquivo;
+   a extensão COMPILED_FILE_EXTENSION é mantida, pois indica um arquivo pré-compilado.
+   Parâmetros:
+   - taskList: Lista de tarefas.
+   - name: Nome (ou caminho) da tarefa.
+   - length: Quantidade de bytes do nome.
+   - priority: Prioridade estática da tarefa (menor valor = maior prioridade).
+   Retorno:
+   - TRUE se o nome foi adicionado, FALSE se não houve memória disponível.
+*/
+boolean addTaskName(TaskList* taskList, const char *name, size_t length, int priority);
+
+/* Lê a prioridade estática de uma tarefa no manifesto: um número inteiro, com sinal opcional, sem outros caracteres.
+   Parâmetros:
+   - text: Texto da prioridade, possivelmente precedido de espaços.
+   - priority: Recebe a prioridade lida.
+   Retorno:
+   - TRUE se o texto é um número inteiro válido, FALSE caso contrário.
+*/
+boolean parseTaskPriority(const char *text, int *priority);
+
+/* Adiciona à lista as tarefas listadas em um arquivo de manifesto.
+   O manifesto contém um nome de tarefa por linha, opcionalmente seguido da sua prioridade estática;
+   linhas vazias e iniciadas por '#' são ignoradas, e uma prioridade inválida é informada com a sua linha.
+   Parâmetros:
+   - taskList: Lista de tarefas.
+   - manifestName: Caminho do arquivo de manifesto.
+   - output: Saída das mensagens de erro.
+   Retorno:
+   - TRUE se o manifesto foi lido, FALSE caso contrário.
+*/
+boolean loadTaskManifest(TaskList* taskList, const char *manifestName, FILE *output);
+
+/* Adiciona à lista as tarefas cujos arquivos correspondem a um padrão glob (ex.: "tarefas/t[0-9]*.tsk").
+   Parâmetros:
+   - taskList: Lista de tarefas.
+   - pattern: Padrão glob dos arquivos de tarefa.
+   Retorno:
+   - TRUE se o padrão foi expandido, FALSE em caso de erro de memória.
+*/
+boolean loadTaskGlob(TaskList* taskList, const char *pattern);
+
+/* Libera a memória da lista de tarefas.
+   Parâmetros:
+   - taskList: Lista de tarefas a ser liberada.
+*/
+void freeTaskList(TaskList* taskList);
+
+/* Aloca a tabela de tarefas de uma simulação, com os vetores de descritores, de nomes e programas
+   e de dados de memória.
+   Parâmetros:
+   - table: Tabela a ser alocada.
+   - numberOfTasks: Número de tarefas.
+   Retorno:
+   - TRUE se a tabela foi alocada, FALSE se não houve memória disponível.
+*/
+boolean createTaskTable(TaskTable* table, int numberOfTasks);
+
+/* Inicializa um descritor de tarefa.
+   Esta função inicializa um descritor de tarefa com valores padrão e um programa vazio.
+   O nome exibido nos relatórios não inclui a extensão COMPILED_FILE_EXTENSION, que continua no nome do arquivo;
+   assim, a mesma tarefa tem o mesmo nome carregada do código-fonte ou pré-compilada.
+   Parâmetros:
+   - descriptor: O descritor de tarefa a ser inicializado.
+   - task: Nome e programa da tarefa, na tabela de tarefas.
+   - memory: Dados de memória da tarefa, na tabela de tarefas.
+   - taskName: O nome da tarefa para identificação.
+*/
+void initializeTaskDescriptor(TaskDescriptor* descriptor, Task* task, TaskMemory* memory, const char *taskName);
+
+/* Prepara a resolução das variáveis de uma tarefa cujo programa já foi carregado.
+   Cria o mapa de símbolo para variável, com uma posição por símbolo do programa, marcando todos como não declarados.
+   Parâmetros:
+   - descriptor: Descritor da tarefa.
+   Retorno:
+   - TRUE se o mapa foi criado, FALSE se não houve memória disponível.
+*/
+boolean initializeTaskVariables(TaskDescriptor* descriptor);
+
+/* Libera as variáveis e o mapa de símbolos de uma tarefa.
+   Parâmetros:
+   - descriptor: Descritor da tarefa.
+*/
+void freeTaskVariables(TaskDescriptor* descriptor);
+
+/* Libera a tabela de tarefas, com os programas, as variáveis, os registros de acesso e as tabelas de páginas.
+   Parâmetros:
+   - table: Tabela a ser liberada.
+*/
+void freeTaskTable(TaskTable* table);
+
+/* Calcula o hash FNV-1a de um identificador.
+   Parâmetros:
+   - identifier: Bytes do identificador.
+   - length: Quantidade de bytes.
+   Retorno:
+   - Hash de 32 bits do identificador.
+*/
+unsigned int hashIdentifier(const char *identifier, unsigned int length);
+
+/* Dobra a tabela hash de símbolos do programa e reinsere os símbolos.
+   Parâmetros:
+   - program: Programa da tarefa.
+   Retorno:
+   - TRUE se a tabela foi ampliada, FALSE se não houve memória disponível.
 */
-void updatePhysicalMemory(TaskDescriptor* taskDescriptor, int index, int value);
+boolean growSymbolBuckets(TaskProgram* program);
 
-/* Executa a instrução 'new' para simular a alocação de variáveis para uma tarefa.
-   Esta função analisa a instrução, identifica a variável e seu valor alocado.
-   Em seguida, verifica se a variável já foi declarada. Se não, aloca a variável na memória lógica e física da tarefa.
+/* Interna um identificador na tabela de símbolos do programa.
+   O identificador é procurado pelo seu hash; se ainda não existir, seus bytes são copiados uma única vez
+   para o vetor de identificadores e um novo símbolo é criado. O custo não depende do número de símbolos.
    Parâmetros:
-   - instruction: Instrução a ser executada.
-   - taskDescriptor: Ponteiro para o descritor de tarefa (TaskDescriptor).
-   - roundRobin: Ponteiro para a estrutura RoundRobin contendo informações do sistema.
+   - program: Programa da tarefa.
+   - identifier: Bytes do identificador.
+   - length: Quantidade de bytes.
+   - symbol: Recebe o índice do símbolo.
    Retorno:
-   - TRUE se a alocação da variável for bem-sucedida, FALSE caso contrário.
+   - TRUE se o identificador foi internado, FALSE se não houve memória disponível.
 */
-boolean new(String instruction, TaskDescriptor* taskDescriptor, RoundRobin* roundRobin);
+boolean internSymbol(TaskProgram* program, const char *identifier, unsigned int length, unsigned int *symbol);
 
-/* Imprime os acessos à memória das variáveis de uma tarefa.
-   Esta função percorre os acessos à memória registrados na estrutura da tarefa e imprime os endereços lógicos e físicos
-   para cada acesso.
+/* Adiciona uma instrução decodificada ao programa da tarefa.
+   O identificador da instrução é internado na tabela de símbolos do programa e a instrução guarda
+   apenas o índice do símbolo.
    Parâmetros:
-   - taskDesc: Descritor da tarefa (TaskDescriptor) contendo os acessos à memória.
+   - program: Programa da tarefa.
+   - parsed: Instrução decodificada pelo analisador léxico.
+   Retorno:
+   - TRUE se a instrução foi adicionada, FALSE se não houve memória disponível.
 */
-void printTaskMemoryAccesses(TaskDescriptor taskDesc);
+boolean appendInstruction(TaskProgram* program, const ParsedInstruction* parsed);
 
-/* Simula um acesso à memória de uma variável.
-   Esta função analisa a instrução fornecida para acessar a memória de uma variável específica da tarefa.
-   Se a variável for encontrada, o acesso à memória é registrado no descritor da tarefa.
+/* Recupera uma instrução do programa da tarefa.
    Parâmetros:
-   - instruction: Instrução de acesso à memória.
-   - taskDescriptor: Ponteiro para o descritor da tarefa (TaskDescriptor).
-   - roundRobin: Ponteiro para a estrutura RoundRobin contendo informações do sistema.
+   - program: Programa da tarefa.
+   - index: Índice da instrução no programa.
+   - instruction: Estrutura que recebe a instrução, com o identificador apontando para o programa.
+*/
+void fetchInstruction(const TaskProgram* program, unsigned int index, ParsedInstruction* instruction);
+
+/* Libera a memória do programa da tarefa, inclusive a imagem do arquivo compilado.
+   Parâmetros:
+   - program: Programa da tarefa a ser liberado.
+*/
+void freeTaskProgram(TaskProgram* program);
+
+/* Inicializa um conjunto de programas residentes vazio.
+   Parâmetros:
+   - pool: Conjunto a ser inicializado.
+   - capacity: Limite de programas residentes, ou 0 para nunca descartar.
+   - output: Saída das mensagens de erro das recargas.
+*/
+void initializeProgramPool(ProgramPool* pool, unsigned int capacity, FILE *output);
+
+/* Insere uma tarefa com programa carregado no início (mais recente) da lista LRU do conjunto.
+   Parâmetros:
+   - pool: Conjunto de programas residentes.
+   - task: Tarefa cujo programa acabou de ser carregado.
+*/
+void linkResidentProgram(ProgramPool* pool, Task* task);
+
+/* Retira uma tarefa da lista LRU do conjunto, sem liberar o programa.
+   Parâmetros:
+   - pool: Conjunto de programas residentes.
+   - task: Tarefa com programa residente.
+*/
+void unlinkResidentProgram(ProgramPool* pool, Task* task);
+
+/* Descarta os programas menos usados recentemente até o conjunto respeitar o seu limite e atualiza o pico de programas residentes.
+   O programa da tarefa em execução e o da tarefa mais recente nunca são descartados; por isso o limite pode ser
+   excedido temporariamente em um programa.
+   Parâmetros:
+   - pool: Conjunto de programas residentes.
+*/
+void evictResidentPrograms(ProgramPool* pool);
+
+/* Registra no conjunto o programa de uma tarefa recém-validada.
+   As primeiras tarefas, que executam primeiro, ficam residentes até o limite; as demais têm o programa descartado
+   logo após a validação e o recarregam no primeiro despacho.
+   Parâmetros:
+   - pool: Conjunto de programas residentes.
+   - task: Tarefa com o programa validado.
+*/
+void admitTaskProgram(ProgramPool* pool, Task* task);
+
+/* Garante que o programa de uma tarefa esteja residente, recarregando-o do arquivo se foi descartado, e o marca
+   como o usado mais recentemente. A tarefa continua do seu contador de programa, pois o programa recarregado é conferido
+   com as contagens do programa validado.
+   Parâmetros:
+   - task: Tarefa cujo programa será usado.
    Retorno:
-   - TRUE se o acesso à memória foi realizado com sucesso; FALSE caso contrário.
+   - TRUE se o programa está residente, FALSE se o arquivo não pôde ser reaberto ou mudou desde a validação.
 */
-boolean memoryAccess(String instruction, TaskDescriptor* taskDescriptor, RoundRobin* roundRobin);
+boolean acquireTaskProgram(Task* task);
 
-/* Finaliza uma tarefa.
-   Esta função atualiza o status de uma tarefa para finalizada e configura a marca de abortada, se aplicável.
-   Atualiza também o tempo de término, fecha o arquivo associado à tarefa e ajusta as métricas globais do sistema.
+/* Libera o programa de uma tarefa finalizada, retirando-o do conjunto de programas residentes.
    Parâmetros:
-   - taskDescriptor: Ponteiro para o descritor da tarefa (TaskDescriptor).
-   - aborted: Indica se a tarefa foi abortada (TRUE) ou concluída com sucesso (FALSE).
-   - roundRobin: Ponteiro para a estrutura RoundRobin contendo informações do sistema.
+   - task: Tarefa finalizada.
 */
-void finishTask(TaskDescriptor* taskDescriptor, boolean aborted, RoundRobin* roundRobin);
+void releaseTaskProgram(Task* task);
 
-/* Verifica e atualiza as tarefas suspensas.
-   Esta função percorre a lista de tarefas e verifica se alguma está suspensa.
-   Se uma tarefa estiver suspensa, ela decrementa o tempo de suspensão pelo número de unidades de tempo especificado.
-   Se o tempo de suspensão chegar a zero, a função atualiza o status da tarefa para READY e a coloca na fila de tarefas prontas.
+/* Decodifica o conteúdo de um arquivo de tarefa diretamente dos seus bytes.
+   As linhas são delimitadas por '\n' e não possuem limite de tamanho. A primeira instrução deve ser o
+   cabeçalho e as demais devem ser dos tipos 1, 2 e 3.
+   Parâmetros:
+   - data: Bytes do arquivo (mapeados em memória ou lidos do descritor).
+   - size: Quantidade de bytes.
+   - program: Programa que recebe as instruções decodificadas.
+   Retorno:
+   - TRUE se todas as instruções são válidas, FALSE caso contrário.
+*/
+boolean parseTaskProgram(const char *data, size_t size, TaskProgram* program);
+
+/* Lê todo o conteúdo de um descritor de arquivo que não pode ser mapeado em memória.
+   Parâmetros:
+   - fileDescriptor: Descritor de arquivo aberto para leitura.
+   - size: Recebe a quantidade de bytes lidos.
+   Retorno:
+   - Buffer alocado com o conteúdo lido (deve ser liberado com free), ou NULL em caso de erro.
+*/
+char* readTaskFileBuffered(int fileDescriptor, size_t* size);
+
+/* Carrega um arquivo de tarefa pré-compilado (.tskb).
+   Arquivos a partir de COMPILED_MAPPING_THRESHOLD bytes são mapeados em memória, e os menores são lidos para um único
+   bloco; o programa aponta diretamente para as instruções, os símbolos e os identificadores da imagem, sem decodificar
+   texto. Apenas a estrutura é verificada: o tamanho das seções, o tipo de cada instrução e os índices de símbolos,
+   de forma que um arquivo corrompido não leva a acessos fora da imagem.
+   Parâmetros:
+   - fileName: Caminho do arquivo compilado, com a extensão.
+   - program: Programa que recebe as instruções; a imagem é liberada por 'freeTaskProgram()'.
+   - output: Saída das mensagens de erro.
+   Retorno:
+   - TRUE se o arquivo é válido, FALSE caso contrário.
+*/
+boolean loadCompiledTask(const char *fileName, TaskProgram* program, FILE *output);
+
+/* Grava o programa de uma tarefa no formato compilado (.tskb).
+   O arquivo é escrito em um arquivo temporário e renomeado ao final, para que um simulador em execução nunca
+   mapeie um arquivo incompleto.
+   Parâmetros:
+   - compiledName: Caminho do arquivo compilado.
+   - program: Programa decodificado de um arquivo de tarefa válido.
+   Retorno:
+   - TRUE se o arquivo foi gravado, FALSE caso contrário.
+*/
+boolean writeCompiledTask(const char *compiledName, const TaskProgram* program);
+
+/* Valida e carrega um arquivo de tarefa.
+   Esta função mapeia o arquivo de tarefa em memória e decodifica suas instruções diretamente dos bytes mapeados,
+   uma única vez, armazenando-as no programa da tarefa. Arquivos que não podem ser mapeados (pipes) são lidos
+   em blocos. O arquivo é fechado ao final da leitura. Um nome terminado em COMPILED_FILE_EXTENSION é carregado
+   pré-compilado, com 'loadCompiledTask()'.
+   Parâmetros:
+   - fileName: O nome do arquivo de tarefa a ser validado.
+   - program: Programa que recebe as instruções decodificadas.
+   - output: Saída das mensagens de erro.
+   Retorno:
+   - TRUE se o arquivo possui um formato válido, FALSE caso contrário.
+*/
+boolean validateFile(const char *fileName, TaskProgram* program, FILE *output);
+
+/* Abre o arquivo do registro de execução de um cenário e grava o início da lista de eventos.
+   Parâmetros:
+   - file: Arquivo do registro de execução.
+   - fileName: Caminho do arquivo.
+   - output: Saída das mensagens de erro.
+   Retorno:
+   - TRUE se o arquivo foi aberto, FALSE caso contrário.
+*/
+boolean openTraceFile(TraceFile* file, const char *fileName, FILE *output);
+
+/* Termina a lista de eventos e fecha o arquivo do registro de execução.
+   Parâmetros:
+   - file: Arquivo do registro de execução.
+   - output: Saída das mensagens de erro.
+   Retorno:
+   - TRUE se todo o registro foi gravado, FALSE caso contrário.
+*/
+boolean closeTraceFile(TraceFile* file, FILE *output);
+
+/* Começa o registro de execução de uma simulação, como um novo processo do arquivo, nomeado pela política de escalonamento,
+   pela substituição de páginas e pelo tamanho de página. Cada tarefa tem uma linha com o seu nome, e cada núcleo uma linha
+   com as tarefas que executou. Todas as tarefas não abortadas começam prontas no instante 0.
    Parâmetros:
-   - queue: Ponteiro para a fila de descritores de tarefas (TaskDescriptorQueue).
-   - tasks: Array de descritores de tarefas (TaskDescriptor).
+   - trace: Registro de execução a ser iniciado.
+   - file: Arquivo do registro de execução.
+   - policy: Política de escalonamento da simulação.
+   - replacement: Política de substituição de páginas, ou NULL.
+   - machine: Geometria de memória da simulação.
+   - numberOfCores: Número de núcleos simulados.
+   - tasks: Array de descritores de tarefa, já carregados.
    - numberOfTasks: Número total de tarefas no array.
-   - timeUnits: Unidades de tempo a serem subtraídas do tempo de suspensão das tarefas.
+   Retorno:
+   - TRUE se o registro foi iniciado, FALSE se não houve memória disponível.
 */
-void checkAndUpdateSuspendedTasks(TaskDescriptorQueue* queue, TaskDescriptor tasks[], int numberOfTasks, unsigned timeUnits);
+boolean openEventTrace(EventTrace* trace, TraceFile* file, const SchedulingPolicy* policy, const ReplacementPolicy* replacement, const MachineConfiguration* machine, unsigned int numberOfCores, const TaskDescriptor tasks[], int numberOfTasks);
 
-/* Arredonda um número float para o inteiro mais próximo.
-   Esta função recebe um número em ponto flutuante e retorna o valor arredondado para o inteiro mais próximo.
+/* Registra a transição de estado de uma tarefa: o intervalo no estado anterior, se não for vazio, e, se a tarefa
+   terminou, o instante do término.
    Parâmetros:
-   - number: Número em ponto flutuante a ser arredondado.
+   - trace: Registro de execução.
+   - taskDescriptor: Tarefa que muda de estado (ainda no estado anterior).
+   - status: Novo estado da tarefa.
+   - now: Instante simulado da transição.
+*/
+void recordTaskStatus(EventTrace* trace, const TaskDescriptor* taskDescriptor, TaskStatus status, TimeUnit now);
+
+/* Acrescenta um texto a uma linha do registro de execução.
+   Parâmetros:
+   - cursor: Posição da linha que recebe o texto.
+   - text: Texto a ser copiado.
    Retorno:
-   - Valor arredondado para o inteiro mais próximo (int).
+   - Posição seguinte ao texto copiado.
 */
-int roundingNumber(float number);
+char* appendTraceText(char *cursor, const char *text);
 
-/* Atualiza a paginação de uma tarefa com base nos bytes alocados.
-   Esta função atualiza os valores de paginação de uma tarefa com base na quantidade de bytes alocados.
+/* Acrescenta um número decimal a uma linha do registro de execução, sem passar pela formatação do printf.
    Parâmetros:
-   - taskDescriptor: Ponteiro para o descritor de tarefa (TaskDescriptor) a ser atualizado.
-   - bytes: Quantidade de bytes alocados.
+   - cursor: Posição da linha que recebe o número.
+   - value: Número a ser escrito.
+   Retorno:
+   - Posição seguinte ao número escrito.
 */
-void updatePagination(TaskDescriptor* taskDescriptor, unsigned int bytes);
+char* appendTraceNumber(char *cursor, unsigned int value);
 
-/* Processa um cabeçalho de instrução para atualizar a paginação de uma tarefa.
-   Esta função processa o cabeçalho de uma instrução para atualizar os valores de paginação
-   de uma tarefa com base nos bytes especificados no cabeçalho.
+/* Acrescenta um texto entre aspas, escapado como em 'printJsonString()', a uma linha do registro de execução.
    Parâmetros:
-   - instruction: String contendo a instrução do cabeçalho.
-   - taskDescriptor: Ponteiro para o descritor de tarefa (TaskDescriptor) a ser atualizado.
-   - roundRobin: Ponteiro para a estrutura RoundRobin contendo informações do sistema.
+   - cursor: Posição da linha que recebe o texto.
+   - text: Texto a ser escapado, com até STRING_DEFAULT_SIZE bytes.
    Retorno:
-   - Retorna TRUE se a operação for bem-sucedida; FALSE, caso contrário.
+   - Posição seguinte ao texto escapado.
+*/
+char* appendTraceString(char *cursor, const char *text);
+
+/* Grava em bloco os eventos acumulados no registro de execução e esvazia o buffer. Os intervalos são eventos completos
+   ('X') na linha da tarefa, e os intervalos em execução são repetidos na linha do núcleo; os términos são eventos
+   instantâneos ('i'). Uma unidade de tempo simulada corresponde a 1 us no visualizador.
+   Parâmetros:
+   - trace: Registro de execução.
+*/
+void flushEventTrace(EventTrace* trace);
+
+/* Grava os eventos restantes e libera o registro de execução de uma simulação.
+   Parâmetros:
+   - trace: Registro de execução.
+*/
+void closeEventTrace(EventTrace* trace);
+
+/* Trata o sinal CHECKPOINT_SIGNAL, pedindo que o estado da simulação em andamento seja salvo no próximo passo do escalonamento.
+   Parâmetros:
+   - signal: Número do sinal.
 */
-boolean header(String instruction, TaskDescriptor* taskDescriptor, RoundRobin* roundRobin);
+void requestCheckpoint(int signal);
 
-/* Determina o tipo de instrução baseado em padrões regex.
-   Esta função verifica o tipo de instrução com base em padrões regex e retorna
-   um enum correspondente ao tipo de instrução encontrado.
+/* Acumula bytes no hash FNV-1a do estado salvo, uma palavra de 64 bits por vez e os bytes restantes um a um.
+   O hash depende da divisão dos bytes, por isso é sempre calculado sobre os mesmos blocos do arquivo.
    Parâmetros:
-   - instruction: String contendo a instrução a ser verificada.
+   - hash: Hash dos bytes anteriores.
+   - data: Bytes acumulados.
+   - size: Quantidade de bytes.
    Retorno:
-   - Retorna um enum do tipo Instruction correspondente ao tipo de instrução encontrado,
-     ou -1 caso não corresponda a nenhum padrão conhecido.
+   - Hash atualizado.
 */
-Instruction determineInstructionType(String instruction);
+uint64_t hashSnapshotBytes(uint64_t hash, const void *data, size_t size);
 
-/* Executa as instruções de uma tarefa dentro do quantum definido.
-   Esta função executa as instruções de uma tarefa dentro do quantum definido pelo RoundRobin.
+/* Grava no arquivo o bloco do estado salvo e o inclui no hash.
    Parâmetros:
-   - queue: Ponteiro para a fila de descritores de tarefa.
-   - roundRobin: Ponteiro para a estrutura RoundRobin contendo informações do sistema.
-   - taskDescriptor: Ponteiro para o descritor da tarefa em execução.
-   - tasks: Array de descritores de tarefas.
-   - numberOfTasks: Número total de tarefas.
+   - stream: Arquivo do estado salvo, aberto para gravação.
+*/
+void flushSnapshotBlock(SnapshotStream* stream);
+
+/* Grava ou lê bytes do estado salvo, conforme o sentido do arquivo, através do bloco em memória. Depois de uma falha,
+   nada mais é transferido.
+   Parâmetros:
+   - stream: Arquivo do estado salvo.
+   - data: Bytes gravados ou que recebem os bytes lidos.
+   - size: Quantidade de bytes.
+*/
+void transferSnapshotBytes(SnapshotStream* stream, void *data, size_t size);
+
+/* Grava ou lê a referência a uma tarefa, pelo seu índice na tabela de tarefas.
+   Parâmetros:
+   - stream: Arquivo do estado salvo.
+   - reference: Tarefa referenciada, ou NULL; ignorada na leitura.
+   - tasks: Array de descritores de tarefa.
+   - numberOfTasks: Número total de tarefas no array.
    Retorno:
-   - Retorna o valor do contador de preempção após a execução das instruções.
+   - Tarefa referenciada, ou NULL se a referência é nula ou inválida (a leitura é marcada como falha).
 */
-int executeInstruction(TaskDescriptorQueue* queue, RoundRobin* roundRobin, TaskDescriptor* taskDescriptor, TaskDescriptor tasks[], int numberOfTasks);
+TaskDescriptor* transferTaskReference(SnapshotStream* stream, const TaskDescriptor* reference, TaskDescriptor tasks[], int numberOfTasks);
 
-/* Inicializa a estrutura RoundRobin com valores iniciais.
-   Esta função atribui valores iniciais aos campos da estrutura RoundRobin.
+/* Grava um valor da configuração da simulação ou, na leitura, confere se o valor salvo é o mesmo.
    Parâmetros:
-   - roundRobin: Ponteiro para a estrutura RoundRobin a ser inicializada.
+   - stream: Arquivo do estado salvo.
+   - value: Valor da simulação atual.
 */
-void initializeRoundRobin(RoundRobin* roundRobin);
+void matchSnapshotValue(SnapshotStream* stream, unsigned int value);
 
-/* Inicializa a fila de descritores de tarefa.
-   Esta função inicializa a fila de descritores de tarefa, enfileirando as tarefas prontas e não abortadas.
+/* Grava um texto da configuração da simulação, precedido do seu tamanho, ou, na leitura, confere se o texto salvo é o mesmo.
+   Parâmetros:
+   - stream: Arquivo do estado salvo.
+   - text: Texto da simulação atual.
+*/
+void matchSnapshotString(SnapshotStream* stream, const char *text);
+
+/* Grava ou lê um texto do estado da simulação, precedido do seu tamanho.
+   Parâmetros:
+   - stream: Arquivo do estado salvo.
+   - text: Texto gravado ou que recebe o texto lido.
+   - size: Capacidade de 'text', incluindo o caractere nulo.
+*/
+void transferSnapshotString(SnapshotStream* stream, char *text, size_t size);
+
+/* Grava ou lê uma fila de descritores, na ordem da fila. Na leitura, a fila deve estar vazia.
    Parâmetros:
-   - taskDescriptorQueue: Ponteiro para a fila de descritores de tarefa a ser inicializada.
+   - stream: Arquivo do estado salvo.
+   - queue: Fila gravada ou que recebe os descritores lidos.
    - tasks: Array de descritores de tarefa.
    - numberOfTasks: Número total de tarefas no array.
 */
-void initializeTaskQueue(TaskDescriptorQueue* taskDescriptorQueue, TaskDescriptor tasks[], int numberOfTasks);
+void transferTaskQueue(SnapshotStream* stream, TaskDescriptorQueue* queue, TaskDescriptor tasks[], int numberOfTasks);
 
-/* Executa o escalonamento e execução das tarefas.
-   Esta função executa o escalonamento e a execução das tarefas enquanto houver tarefas a serem processadas.
+/* Grava ou lê um heap de descritores com a disposição exata do seu vetor, de modo que os empates continuem
+   sendo desfeitos como na simulação salva. Na leitura, o heap deve estar vazio.
    Parâmetros:
-   - taskDescriptorQueue: Ponteiro para a fila de descritores de tarefa.
-   - roundRobin: Estrutura de informações do Round-Robin.
+   - stream: Arquivo do estado salvo.
+   - heap: Heap gravado ou que recebe os descritores lidos.
+   - tasks: Array de descritores de tarefa.
+   - numberOfTasks: Número total de tarefas no array.
+*/
+void transferTaskHeap(SnapshotStream* stream, TaskDescriptorHeap* heap, TaskDescriptor tasks[], int numberOfTasks);
+
+/* Grava ou lê os dados de memória de uma tarefa: variáveis, tabela de páginas, contadores, registro de acessos e,
+   se a tarefa não terminou, o mapa de símbolo para variável. Na leitura, as variáveis, a tabela de páginas e o registro
+   de acessos devem estar vazios.
+   Parâmetros:
+   - stream: Arquivo do estado salvo.
+   - memory: Dados de memória gravados ou que recebem os dados lidos.
+   - numberOfSymbols: Número de símbolos do programa da tarefa.
+*/
+void transferTaskMemory(SnapshotStream* stream, TaskMemory* memory, unsigned int numberOfSymbols);
+
+/* Grava ou lê o conjunto de programas residentes: as suas estatísticas, a lista LRU, da tarefa usada mais recentemente
+   à menos recente, e a tarefa protegida do descarte. Na leitura, os programas ausentes da lista são descartados e os
+   que faltam são recarregados dos arquivos, de modo que os descartes e as recargas seguintes sejam os da simulação salva.
+   Parâmetros:
+   - stream: Arquivo do estado salvo.
+   - pool: Conjunto de programas residentes.
+   - tasks: Array de descritores de tarefa.
+   - numberOfTasks: Número total de tarefas no array.
+*/
+void transferProgramPool(SnapshotStream* stream, ProgramPool* pool, TaskDescriptor tasks[], int numberOfTasks);
+
+/* Grava ou lê o estado completo de uma simulação entre dois passos do escalonamento. O arquivo começa com a identificação
+   e com a configuração da simulação, conferida na leitura: política de escalonamento e de substituição de páginas,
+   geometria de memória (exceto o quantum), TLB, núcleos, limite de programas residentes e, para cada tarefa, o arquivo e
+   as contagens de instruções e de símbolos do programa. Seguem os contadores da simulação, o alocador de quadros, o
+   escalonador (relógios, estruturas de prontos da política, TLBs, fila de despertar e fila de espera por memória), os
+   descritores e os dados de memória das tarefas e o conjunto de programas residentes; os programas em si não são salvos,
+   pois são recarregados dos arquivos das tarefas, que continuam dos seus contadores de programa.
+   Na leitura, o escalonador e o alocador de quadros devem estar recém-inicializados e as tarefas, recém-carregadas.
+   Parâmetros:
+   - stream: Arquivo do estado salvo.
+   - scheduler: Ponteiro para o escalonador.
+   - roundRobin: Estrutura RoundRobin com os contadores, o alocador de quadros e a configuração da simulação.
    - tasks: Array de descritores de tarefa.
    - numberOfTasks: Número total de tarefas no array.
+   - pool: Conjunto de programas residentes.
 */
-void runTasks(TaskDescriptorQueue* taskDescriptorQueue, RoundRobin* roundRobin, TaskDescriptor tasks[], int numberOfTasks);
+void transferSimulationState(SnapshotStream* stream, Scheduler* scheduler, RoundRobin* roundRobin, TaskDescriptor tasks[], int numberOfTasks, ProgramPool* pool);
 
-/* Agenda e executa as tarefas usando o algoritmo Round-Robin.
-   Esta função cria uma estrutura RoundRobin, uma fila de descritores de tarefa e coordena a execução das tarefas
-   usando o algoritmo Round-Robin até que todas as tarefas tenham sido executadas.
+/* Salva o estado da simulação no arquivo do estado salvo. O estado é gravado em um arquivo temporário, seguido do hash
+   dos seus bytes, e só então substitui o estado salvo anterior, que continua válido se a gravação for interrompida.
    Parâmetros:
+   - checkpoint: Arquivo e instante do estado salvo; 'saveFailed' é marcado se a gravação falhar.
+   - scheduler: Ponteiro para o escalonador.
+   - roundRobin: Estrutura de informações do Round-Robin.
    - tasks: Array de descritores de tarefa.
    - numberOfTasks: Número total de tarefas no array.
    Retorno:
-   - Estrutura RoundRobin com informações de execução das tarefas.
+   - TRUE se o estado foi salvo, FALSE caso contrário.
 */
-RoundRobin scheduleTasks(TaskDescriptor tasks[], int numberOfTasks);
+boolean saveSnapshot(Checkpoint* checkpoint, Scheduler* scheduler, RoundRobin* roundRobin, TaskDescriptor tasks[], int numberOfTasks);
 
-/* Verifica se uma string corresponde a um padrão de expressão regular.
-   Esta função utiliza a biblioteca POSIX para compilar e executar uma expressão regular
-   e verifica se a string fornecida corresponde ao padrão especificado.
+/* Confere o hash do estado salvo antes da leitura, para que um arquivo truncado ou corrompido não seja aplicado à simulação.
+   O hash é calculado sobre os mesmos blocos da gravação.
    Parâmetros:
-   - string: A string a ser verificada.
-   - pattern: O padrão de expressão regular a ser comparado com a string.
+   - stream: Arquivo do estado salvo, aberto para leitura e posicionado no início; o seu bloco é usado na leitura.
    Retorno:
-   - TRUE se a string corresponde ao padrão, FALSE caso contrário.
+   - TRUE se o hash gravado ao final do arquivo corresponde aos bytes anteriores, FALSE caso contrário.
 */
-boolean matchRegex(String string, const char *pattern);
+boolean verifySnapshotChecksum(SnapshotStream* stream);
 
-/* Valida o número de argumentos fornecidos ao programa.
-   Esta função verifica se o número de argumentos está dentro do intervalo esperado
-   para a execução do programa, com base na quantidade de tarefas previamente definida.
+/* Restaura o estado salvo de uma simulação no lugar da admissão das tarefas, para que a simulação continue do passo
+   em que o estado foi salvo e produza o mesmo resultado da execução sem interrupção. O quantum é o da simulação atual.
    Parâmetros:
-   - numberOfArguments: O número de argumentos fornecidos ao programa.
+   - checkpoint: Arquivo do estado restaurado, conjunto de programas residentes e saída das mensagens de erro.
+   - scheduler: Ponteiro para o escalonador, recém-inicializado.
+   - roundRobin: Estrutura de informações do Round-Robin, recém-inicializada.
+   - tasks: Array de descritores de tarefa, recém-carregados.
+   - numberOfTasks: Número total de tarefas no array.
    Retorno:
-   - TRUE se o número de argumentos estiver dentro do intervalo esperado, FALSE caso contrário.
+   - TRUE se o estado foi restaurado, FALSE se o arquivo não pôde ser lido, está corrompido ou é de outra simulação.
 */
-boolean validateNumberOfArguments(int numberOfArguments);
+boolean restoreSnapshot(Checkpoint* checkpoint, Scheduler* scheduler, RoundRobin* roundRobin, TaskDescriptor tasks[], int numberOfTasks);
 
-/* Inicializa um descritor de tarefa.
-   Esta função inicializa um descritor de tarefa com valores padrão e abre o arquivo de tarefa associado.
+/* Executa uma simulação completa com uma política de escalonamento e imprime os relatórios.
+   Cada simulação carrega os arquivos de tarefa em uma tabela de tarefas própria, alocada no heap,
+   para que várias políticas possam ser comparadas sobre a mesma carga de trabalho. A simulação não usa
+   estado global mutável, podendo executar em paralelo com outras simulações.
    Parâmetros:
-   - descriptor: O descritor de tarefa a ser inicializado.
-   - taskName: O nome da tarefa para identificação.
+   - taskList: Lista de tarefas a serem escalonadas.
+   - policy: Política de escalonamento.
+   - replacement: Política de substituição de páginas, ou NULL para manter as páginas residentes.
+   - tlb: Configuração da TLB dos núcleos.
+   - machine: Geometria de memória e quantum, já configurados por 'configureMachine()'.
+   - numberOfCores: Número de núcleos simulados.
+   - residentPrograms: Limite de programas decodificados residentes, ou 0 para manter todos.
+   - traceFile: Arquivo do registro de execução, que recebe a simulação como um novo processo, ou NULL.
+   - checkpoint: Estado salvo (-k) e restaurado (-R) da simulação, ou NULL.
+   - reportFormat: Formato do relatório; nos formatos lidos por programas, as mensagens de erro das tarefas vão para stderr.
+   - output: Saída dos relatórios.
+   Retorno:
+   - EXIT_SUCCESS se a execução for bem-sucedida, EXIT_FAILURE caso contrário.
 */
-void initializeTaskDescriptor(TaskDescriptor* descriptor, String taskName);
+int runSimulation(TaskList* taskList, const SchedulingPolicy* policy, const ReplacementPolicy* replacement, const TlbConfiguration* tlb, const MachineConfiguration* machine, unsigned int numberOfCores, unsigned int residentPrograms, TraceFile* traceFile, Checkpoint* checkpoint, const ReportFormat* reportFormat, FILE *output);
 
-/* Valida um arquivo de tarefa.
-   Esta função verifica se um arquivo de tarefa possui um formato válido, verificando suas instruções.
+/* Lê um valor numérico da geometria de memória ou do quantum.
    Parâmetros:
-   - fileName: O nome do arquivo de tarefa a ser validado.
+   - text: Valor informado.
+   - minimum: Menor valor aceito.
+   - maximum: Maior valor aceito.
+   - value: Recebe o valor lido.
    Retorno:
-   - TRUE se o arquivo possui um formato válido, FALSE caso contrário.
+   - TRUE se o valor é um número dentro dos limites, FALSE caso contrário.
+*/
+boolean parseMachineValue(const char *text, unsigned int minimum, unsigned int maximum, unsigned int *value);
+
+/* Lê a lista de tamanhos de página, separada por vírgulas, substituindo a lista anterior do cenário.
+   Parâmetros:
+   - scenario: Cenário que recebe os tamanhos de página.
+   - text: Lista de tamanhos de página, em bytes.
+   Retorno:
+   - TRUE se todos os tamanhos são números válidos, FALSE caso contrário.
+*/
+boolean parsePageSizes(Scenario* scenario, const char *text);
+
+/* Lê a geometria de memória e o quantum de um arquivo de configuração.
+   Cada linha contém uma chave (pagina, memoria_fisica, memoria_logica ou quantum) seguida do valor;
+   a chave pagina aceita uma lista de tamanhos separada por vírgulas. Linhas vazias e iniciadas por '#'
+   são ignoradas, e as opções seguintes da linha de comando sobrescrevem os valores lidos.
+   Parâmetros:
+   - scenario: Cenário que recebe a configuração.
+   - configurationName: Caminho do arquivo de configuração.
+   - output: Saída das mensagens de erro.
+   Retorno:
+   - TRUE se o arquivo foi lido, FALSE caso contrário.
+*/
+boolean loadMachineConfiguration(Scenario* scenario, const char *configurationName, FILE *output);
+
+/* Lê a opção -k: o instante, opcional, e o arquivo em que o estado da simulação é salvo.
+   Sem o instante, o estado é salvo apenas quando o processo recebe o sinal CHECKPOINT_SIGNAL, que o modo em lote ignora.
+   Parâmetros:
+   - scenario: Cenário que recebe o arquivo e o instante.
+   - text: Valor informado, no formato [instante:]arquivo.
+   Retorno:
+   - TRUE se o valor é válido, FALSE caso contrário.
+*/
+boolean parseCheckpoint(Scenario* scenario, const char *text);
+
+/* Lê as opções e os nomes de tarefa de um cenário.
+   As opções são as mesmas da linha de comando. Em caso de erro, a mensagem e o uso do programa são escritos
+   na saída informada e o cenário é marcado como falho, sem encerrar o processo.
+   Parâmetros:
+   - scenario: Cenário a ser preenchido, zerado; um formato de relatório já definido é usado como padrão do -o.
+   - numberOfArguments: Número de argumentos.
+   - arguments: Argumentos (o primeiro é o nome do programa).
+   - output: Saída das mensagens de erro.
+   Retorno:
+   - EXIT_SUCCESS se o cenário é válido, EXIT_FAILURE caso contrário.
+*/
+int parseScenario(Scenario* scenario, int numberOfArguments, char *arguments[], FILE *output);
+
+/* Executa as simulações de um cenário, uma por tamanho de página e por política de escalonamento e de
+   substituição de páginas, e escreve os relatórios na saída informada.
+   Parâmetros:
+   - scenario: Cenário válido.
+   - output: Saída dos relatórios.
+   Retorno:
+   - EXIT_SUCCESS se a execução for bem-sucedida, EXIT_FAILURE caso contrário.
+*/
+int runScenario(Scenario* scenario, FILE *output);
+
+/* Libera a memória de um cenário.
+   Parâmetros:
+   - scenario: Cenário a ser liberado.
+*/
+void freeScenario(Scenario* scenario);
+
+/* Divide uma linha da lista de cenários em argumentos separados por espaços.
+   A linha é modificada no lugar: os separadores são substituídos por caracteres nulos.
+   Parâmetros:
+   - line: Linha a ser dividida.
+   - programName: Nome do programa, usado como primeiro argumento.
+   - numberOfArguments: Recebe o número de argumentos.
+   Retorno:
+   - Vetor de argumentos alocado no heap (terminado em NULL), ou NULL se não houver memória disponível.
+*/
+char** splitScenarioArguments(char *line, const char *programName, int *numberOfArguments);
+
+/* Lê a lista de cenários do modo em lote.
+   Cada linha contém as opções e tarefas de um cenário, como na linha de comando; linhas vazias e iniciadas
+   por '#' são ignoradas. Os cenários são lidos na thread principal (o getopt não é reentrante), e o relatório
+   de cada um, inclusive os erros de leitura, é acumulado em memória.
+   Parâmetros:
+   - batchFileName: Caminho da lista de cenários.
+   - programName: Nome do programa, usado nas mensagens de uso.
+   - reportFormat: Formato de relatório dos cenários que não informam -o.
+   - numberOfScenarios: Recebe o número de cenários lidos.
+   Retorno:
+   - Vetor de cenários alocado no heap, ou NULL em caso de erro.
+*/
+Scenario* loadScenarios(const char *batchFileName, const char *programName, const ReportFormat* reportFormat, int *numberOfScenarios);
+
+/* Laço de uma thread do modo em lote: retira cenários da fila compartilhada e os executa até a fila esvaziar.
+   Cada cenário escreve apenas no seu próprio relatório em memória.
+   Parâmetros:
+   - argument: Ponteiro para a fila de cenários (ScenarioQueue).
+   Retorno:
+   - NULL.
+*/
+void* runScenarioWorker(void *argument);
+
+/* Executa os cenários de uma lista em paralelo e imprime os relatórios na ordem da lista.
+   As simulações são distribuídas entre um conjunto de threads (por padrão, uma por núcleo do computador);
+   a thread principal também executa cenários. Cada relatório é acumulado em memória e impresso inteiro,
+   após o término de todas as threads, de forma que a saída dos cenários não se intercala. Cada relatório é precedido
+   da identificação do cenário no seu formato, e o cabeçalho de cada formato é impresso antes do primeiro relatório.
+   Parâmetros:
+   - batchFileName: Caminho da lista de cenários.
+   - programName: Nome do programa.
+   - numberOfThreads: Número de threads, ou 0 para usar o número de núcleos do computador.
+   - locale: Região usada pelas threads.
+   - reportFormat: Formato de relatório dos cenários que não informam -o.
+   Retorno:
+   - EXIT_SUCCESS se todos os cenários foram executados com sucesso, EXIT_FAILURE caso contrário.
+*/
+int runBatch(const char *batchFileName, const char *programName, int numberOfThreads, locale_t locale, const ReportFormat* reportFormat);
+
+/* Compilador de tarefas (tsmm-compile): decodifica cada arquivo de tarefa e grava o programa no formato .tskb,
+   ao lado do arquivo original, para que o simulador carregue a tarefa sem analisar o texto.
+   Parâmetros:
+   - numberOfArguments: Número de argumentos do programa.
+   - arguments: Argumentos do programa (nomes dos arquivos de tarefa, com ou sem a extensão FILE_EXTENSION).
+   Retorno:
+   - EXIT_SUCCESS se todas as tarefas foram compiladas, EXIT_FAILURE caso contrário.
+*/
+int tsmmCompile(int numberOfArguments, char *arguments[]);
+
+/* Gera o próximo número pseudoaleatório de uma carga de trabalho sintética (SplitMix64).
+   O gerador não depende de rand(), de forma que a mesma semente gera a mesma carga em qualquer plataforma.
+   Parâmetros:
+   - state: Estado do gerador, avançado a cada chamada.
+   Retorno:
+   - Número pseudoaleatório de 64 bits.
+*/
+uint64_t nextWorkloadRandom(uint64_t *state);
+
+/* Sorteia um número entre 0 e bound - 1.
+   Parâmetros:
+   - state: Estado do gerador.
+   - bound: Limite superior (exclusivo), maior que 0.
+   Retorno:
+   - Número sorteado.
+*/
+unsigned int workloadRandomBelow(uint64_t *state, unsigned int bound);
+
+/* Gera o texto de uma tarefa da carga de trabalho sintética.
+   A tarefa começa pelo cabeçalho e pelas declarações das variáveis, cujos tamanhos somados ao cabeçalho cabem na
+   memória lógica padrão, seguidos das instruções: leituras de disco no percentual pedido e, nas demais, acessos a
+   posições válidas de variáveis sorteadas. Cada tarefa tem um estado próprio, derivado da semente e do seu índice,
+   de forma que a tarefa i é a mesma qualquer que seja o número de tarefas da carga.
+   Parâmetros:
+   - spec: Especificação da carga de trabalho.
+   - index: Índice da tarefa na carga.
+   - size: Recebe a quantidade de bytes gerados.
+   Retorno:
+   - Texto da tarefa (deve ser liberado com free), ou NULL se não houve memória disponível.
+*/
+char* generateTaskSource(const WorkloadSpec* spec, unsigned int index, size_t *size);
+
+/* Grava uma carga de trabalho sintética em arquivos de tarefa, um por tarefa, no diretório informado.
+   O diretório é criado se não existir, e os arquivos podem ser usados pelo simulador com -g ou compilados com tsmm-compile.
+   Parâmetros:
+   - spec: Especificação da carga de trabalho.
+   - directory: Diretório que recebe os arquivos.
+   Retorno:
+   - TRUE se todos os arquivos foram gravados, FALSE caso contrário.
+*/
+boolean writeWorkload(const WorkloadSpec* spec, const char *directory);
+
+/* Gera em memória o texto de todas as tarefas de uma carga de trabalho sintética.
+   Parâmetros:
+   - workload: Carga de trabalho a ser criada.
+   - spec: Especificação da carga de trabalho.
+   Retorno:
+   - TRUE se a carga foi gerada, FALSE se não houve memória disponível.
+*/
+boolean createWorkload(Workload* workload, const WorkloadSpec* spec);
+
+/* Libera o texto das tarefas de uma carga de trabalho sintética.
+   Parâmetros:
+   - workload: Carga de trabalho a ser liberada.
+*/
+void freeWorkload(Workload* workload);
+
+/* Calcula o tempo decorrido desde um instante do relógio monotônico.
+   Parâmetros:
+   - start: Instante inicial, lido com clock_gettime(CLOCK_MONOTONIC).
+   Retorno:
+   - Tempo decorrido, em nanossegundos.
+*/
+double elapsedNanoseconds(const struct timespec* start);
+
+#ifdef TSMM_INSTRUMENTATION
+
+/* Acumula o tempo de um trecho medido na instrumentação.
+   Parâmetros:
+   - timer: Trecho medido.
+   - start: Instante em que o trecho começou, lido com clock_gettime(CLOCK_MONOTONIC).
+*/
+void stopInstrumentationTimer(InstrumentationTimer timer, const struct timespec* start);
+
+/* Imprime a tabela da instrumentação da simulação: chamadas, tempo total e tempo médio de cada trecho medido,
+   seguidos das contagens de eventos. O tempo de validateFile inclui o de determineInstructionType.
+   Parâmetros:
+   - output: Saída da tabela.
+*/
+void printInstrumentation(FILE *output);
+
+#endif
+
+/* Imprime o resultado de um microbenchmark: o custo médio de uma operação e a vazão de operações.
+   Parâmetros:
+   - component: Componente medido.
+   - numberOfTasks: Número de tarefas da carga de trabalho.
+   - operation: Unidade medida (linha, tarefa, instrução simulada...).
+   - nanoseconds: Tempo total medido.
+   - operations: Número de operações executadas no tempo medido.
+*/
+void printBenchmarkResult(const char *component, unsigned int numberOfTasks, const char *operation, double nanoseconds, unsigned long long operations);
+
+/* Mede a decodificação de instruções ('determineInstructionType()') sobre todas as linhas da carga de trabalho.
+   Parâmetros:
+   - workload: Carga de trabalho sintética.
+*/
+void benchmarkInstructionDecoding(const Workload* workload);
+
+/* Mede as operações das filas de descritores: a fila encadeada das tarefas prontas (enfileirar e desenfileirar)
+   e o heap de tarefas suspensas ordenado pelo instante de despertar (inserir e remover).
+   Parâmetros:
+   - workload: Carga de trabalho sintética, que define o número de descritores e a semente dos instantes de despertar.
+*/
+void benchmarkTaskQueues(const Workload* workload);
+
+/* Mede o despertar das tarefas suspensas ('checkAndUpdateSuspendedTasks()'), avançando o relógio uma unidade de tempo
+   por chamada até todas as tarefas despertarem. As tarefas são suspensas com instantes de despertar sorteados entre
+   1 e o número de tarefas, e voltam às filas de prontos do Round-Robin; apenas o despertar é medido.
+   Parâmetros:
+   - workload: Carga de trabalho sintética, que define o número de tarefas e a semente dos instantes de despertar.
+*/
+void benchmarkSuspendedTasks(const Workload* workload);
+
+/* Decodifica a carga de trabalho em uma tabela de tarefas e executa uma simulação Round-Robin com a máquina padrão,
+   medindo apenas o escalonamento ('scheduleTasks()').
+   Parâmetros:
+   - workload: Carga de trabalho sintética.
+   - table: Tabela que recebe as tarefas simuladas (deve ser liberada com 'freeTaskTable()' se o retorno não for 0).
+   - roundRobin: Recebe o resultado da simulação.
+   - output: Saída das mensagens da simulação.
+   - elapsed: Recebe o tempo da simulação, em nanossegundos.
+   Retorno:
+   - Número de instruções simuladas, ou 0, com a tabela já liberada e o erro impresso, se não houve memória para a tabela
+     de tarefas, alguma tarefa foi abortada ou nenhuma instrução foi simulada.
+*/
+unsigned long long simulateWorkload(const Workload* workload, TaskTable* table, RoundRobin* roundRobin, FILE *output, double *elapsed);
+
+/* Mede a simulação completa, em instruções simuladas por segundo, e em seguida os geradores de relatório de cada
+   formato sobre o resultado da última simulação. Os relatórios são gravados em /dev/null.
+   Parâmetros:
+   - workload: Carga de trabalho sintética.
+   Retorno:
+   - TRUE se a simulação foi medida, FALSE se não houve memória ou alguma tarefa da carga foi abortada.
+*/
+boolean benchmarkSimulationAndReports(const Workload* workload);
+
+/* Lê a lista de contagens de tarefas, separada por vírgulas.
+   Parâmetros:
+   - text: Lista de contagens de tarefas.
+   - counts: Recebe as contagens, até MAXIMUM_WORKLOAD_TASK_COUNTS.
+   - numberOfCounts: Recebe o número de contagens lidas.
+   Retorno:
+   - TRUE se todas as contagens são números válidos, FALSE caso contrário.
+*/
+boolean parseTaskCounts(const char *text, unsigned int counts[], unsigned int *numberOfCounts);
+
+/* Microbenchmarks e gerador de cargas de trabalho sintéticas (tsmm-bench).
+   Sem -w, gera em memória uma carga de trabalho para cada contagem de tarefas (-n) e mede o custo por operação e a
+   vazão da decodificação de instruções, das filas de descritores, do despertar das tarefas suspensas, da simulação
+   completa (instruções simuladas por segundo) e dos relatórios. Com -w, grava a carga de uma única contagem de tarefas
+   em arquivos de tarefa no diretório informado. As opções -i, -v e -d definem as instruções, as variáveis e o percentual
+   de leituras de disco de cada tarefa, e -s a semente: a mesma semente gera sempre a mesma carga.
+   Parâmetros:
+   - numberOfArguments: Número de argumentos do programa.
+   - arguments: Argumentos do programa (opções).
+   Retorno:
+   - EXIT_SUCCESS se a execução for bem-sucedida, EXIT_FAILURE caso contrário.
 */
-boolean validateFile(FileName fileName);
+int tsmmBench(int numberOfArguments, char *arguments[]);
 
 /* Função principal para execução do escalonamento de tarefas e imprimir os relatórios.
+   As tarefas podem ser informadas como argumentos, por um manifesto (-m) ou por um padrão glob (-g).
+   A opção -p escolhe a política de escalonamento; uma lista separada por vírgulas executa uma simulação
+   por política sobre a mesma carga de trabalho. A opção -r ativa a paginação sob demanda com as políticas de
+   substituição de páginas informadas, uma simulação por combinação de políticas. A opção -t coloca uma TLB
+   em cada núcleo. As opções -M, -L e -q definem a memória física, a memória lógica e o quantum, e -s uma lista
+   de tamanhos de página, com uma simulação por tamanho; -f lê esses valores de um arquivo de configuração.
+   A opção -c define o número de núcleos simulados, e -o o formato dos relatórios (texto, jsonl ou csv).
+   A opção -P limita os programas decodificados residentes; os demais são recarregados do arquivo quando executam.
+   A opção -T grava as transições de estado das tarefas de todas as simulações em um registro de execução no formato
+   JSON de eventos do Chrome, visualizado como um gráfico de Gantt em chrome://tracing ou no Perfetto.
+   A opção -k salva o estado completo da simulação em um arquivo binário, no instante informado ou ao receber o sinal
+   CHECKPOINT_SIGNAL, e a opção -R continua uma simulação a partir do estado salvo, com o mesmo resultado da execução
+   sem interrupção; as duas exigem uma única simulação, e a restauração, as mesmas tarefas e configuração, exceto o quantum.
+   No modo em lote, o estado é salvo apenas no instante informado.
+   A opção -b executa em paralelo os cenários de uma lista (-j define o número de threads).
+   Tarefas informadas com a extensão COMPILED_FILE_EXTENSION são carregadas pré-compiladas (ver 'tsmmCompile()').
+   A região é aplicada apenas às threads do programa (uselocale), sem alterar a região global do processo,
+   e nenhum erro encerra o processo: o código de saída é retornado ao chamador.
    Parâmetros:
-   - numberOfTasks: Número de tarefas a serem escalonadas.
-   - tasks: Array de strings contendo os nomes dos arquivos de tarefa.
+   - numberOfArguments: Número de argumentos do programa.
+   - arguments: Argumentos do programa (opções e nomes dos arquivos de tarefa).
    Retorno:
    - EXIT_SUCCESS se a execução for bem-sucedida, EXIT_FAILURE caso contrário.
 */
-int tsmm(int numberOfTasks, char *tasks[]);
+int tsmm(int numberOfArguments, char *arguments[]);